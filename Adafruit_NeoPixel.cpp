@@ -82,7 +82,15 @@
   @return  Adafruit_NeoPixel object. Call the begin() function before use.
 */
 Adafruit_NeoPixel::Adafruit_NeoPixel(uint16_t n, int16_t p, neoPixelType t)
-    : begun(false), brightness(0), pixels(NULL), endTime(0) {
+    : begun(false), brightness(0), extractWhite(false),
+      temperature(NEO_TEMP_NONE), pixels(NULL), endTime(0), maxCurrent(0),
+      limitBuf(NULL) {
+  setChip(NEO_CHIP_WS2812B);
+  setCurrentModel(20, 20, 20);
+  setColorCorrection(255, 255, 255);
+#if defined(NEO_SHOW_STATS)
+  resetStats();
+#endif
   updateType(t);
   updateLength(n);
   setPin(p);
@@ -107,10 +115,18 @@ Adafruit_NeoPixel::Adafruit_NeoPixel(uint16_t n, int16_t p, neoPixelType t)
 Adafruit_NeoPixel::Adafruit_NeoPixel()
     :
 #if defined(NEO_KHZ400)
-      is800KHz(true),
+      is800KHz(true), isFast(false),
 #endif
       begun(false), numLEDs(0), numBytes(0), pin(-1), brightness(0),
-      pixels(NULL), rOffset(1), gOffset(0), bOffset(2), wOffset(1), endTime(0) {
+      extractWhite(false), temperature(NEO_TEMP_NONE), pixels(NULL),
+      rOffset(1), gOffset(0), bOffset(2), wOffset(1), endTime(0),
+      maxCurrent(0), limitBuf(NULL) {
+  setChip(NEO_CHIP_WS2812B);
+  setCurrentModel(20, 20, 20);
+  setColorCorrection(255, 255, 255);
+#if defined(NEO_SHOW_STATS)
+  resetStats();
+#endif
 }
 
 /*!
@@ -132,6 +148,7 @@ Adafruit_NeoPixel::~Adafruit_NeoPixel() {
 #endif
 
   free(pixels);
+  free(limitBuf);
   if (pin >= 0)
     pinMode(pin, INPUT);
 }
@@ -184,6 +201,8 @@ void Adafruit_NeoPixel::updateLength(uint16_t n) {
   } else {
     numLEDs = numBytes = 0;
   }
+  if (maxCurrent)
+    setMaxCurrent(maxCurrent); // Resize current limiting buffer
 }
 
 /*!
@@ -211,7 +230,8 @@ void Adafruit_NeoPixel::updateType(neoPixelType t) {
   gOffset = (t >> 2) & 0b11;
   bOffset = t & 0b11;
 #if defined(NEO_KHZ400)
-  is800KHz = (t < 256); // 400 KHz flag is 1<<8
+  is800KHz = !(t & NEO_KHZ400); // 400 KHz flag is 1<<8
+  isFast = (t & NEO_KHZFAST);   // Overclock flag is 1<<9
 #endif
 
   // If bytes-per-pixel has changed (and pixel data was previously
@@ -224,6 +244,158 @@ void Adafruit_NeoPixel::updateType(neoPixelType t) {
 }
 
 
+// Nominal datasheet timing for each chip, in neoPixelChip order: '0' bit
+// high time, '1' bit high time and bit period in nanoseconds, then latch
+// time in microseconds (same layout as neoPixelTiming). WS2811 is given
+// for its 800 KHz mode; the 400 KHz mode is selected with NEO_KHZ400.
+static const uint16_t PROGMEM _NeoPixelChipTiming[NEO_CHIP_COUNT][4] = {
+    {400, 800, 1250, 300}, // WS2812B
+    {350, 700, 1250, 50},  // WS2812
+    {300, 600, 1250, 80},  // SK6812
+    {250, 600, 1250, 280}, // WS2811
+    {300, 750, 1250, 280}, // WS2813, WS2815
+    {360, 720, 1250, 200}, // TM1814
+};
+
+/*!
+  @brief   Apply the known characteristics of a particular driver chip to
+           the strip: bit timing (see neoPixelTiming for which
+           architectures use this) and the data latch (reset) interval.
+           Chips that latch sooner than the WS2812B allow a higher frame
+           rate, especially on short strips where the latch dominates.
+  @param   chip  One of the neoPixelChip values, e.g. NEO_CHIP_SK6812.
+  @note    Color order is still set via the NEO_* type given to the
+           constructor or updateType(). On RP2040, call this before
+           begin().
+*/
+void Adafruit_NeoPixel::setChip(neoPixelChip chip) {
+  if (chip < NEO_CHIP_COUNT) {
+    timing.t0h = pgm_read_word(&_NeoPixelChipTiming[chip][0]);
+    timing.t1h = pgm_read_word(&_NeoPixelChipTiming[chip][1]);
+    timing.period = pgm_read_word(&_NeoPixelChipTiming[chip][2]);
+    timing.latch = pgm_read_word(&_NeoPixelChipTiming[chip][3]);
+  }
+}
+
+// Private, used by architectures with adjustable timing. Returns the bit
+// timing for the data stream: the strip's chip timing, unless NEO_KHZ400
+// was specified, which always gets the classic 400 KHz WS2811 timing, or
+// NEO_KHZFAST, which shortens all of the chip's bit times by 1/5.
+neoPixelTiming Adafruit_NeoPixel::bitTiming(void) const {
+  neoPixelTiming t = timing;
+#if defined(NEO_KHZ400)
+  if (!is800KHz) {
+    t.t0h = 500;
+    t.t1h = 1200;
+    t.period = 2500;
+  } else if (isFast) {
+    t.t0h = t.t0h * 4 / 5;
+    t.t1h = t.t1h * 4 / 5;
+    t.period = t.period * 4 / 5;
+  }
+#endif
+  return t;
+}
+
+/*!
+  @brief   Set a power budget for the strip. When set, show() estimates
+           the current each frame will draw (see estimateCurrent()) and, if
+           over budget, transmits a proportionally dimmed copy of the frame
+           that just fits. Pixel data in RAM is not altered, so the full
+           colors return as soon as a frame fits within budget.
+  @param   mA  Maximum current in milliamps, or 0 (the default) to disable
+               limiting.
+  @return  true on success, false if there's insufficient RAM for the
+           dimmed copy, in which case limiting is left disabled.
+  @note    This is an estimate, not a measurement; allow some margin below
+           the power supply rating. The dimmed copy is kept in a second
+           buffer the size of the pixel data, allocated here (and again if
+           the strip length changes) rather than on each show().
+*/
+bool Adafruit_NeoPixel::setMaxCurrent(uint16_t mA) {
+  free(limitBuf);
+  limitBuf = NULL;
+  maxCurrent = mA;
+  if (mA && numBytes && !(limitBuf = (uint8_t *)malloc(numBytes))) {
+    maxCurrent = 0;
+    return false;
+  }
+  return true;
+}
+
+/*!
+  @brief   Configure the per-pixel current model used by estimateCurrent()
+           and setMaxCurrent(). Defaults suit typical 5V WS2812B/SK6812
+           pixels; measure or check the datasheet for other parts.
+  @param   r     Current of the red element at full (255) intensity, mA.
+  @param   g     Current of the green element at full intensity, mA.
+  @param   b     Current of the blue element at full intensity, mA.
+  @param   w     Current of the white element at full intensity, mA
+                 (ignored for RGB pixels). Default is 20.
+  @param   idle  Quiescent current drawn by each pixel even when off, mA.
+                 Default is 1.
+*/
+void Adafruit_NeoPixel::setCurrentModel(uint8_t r, uint8_t g, uint8_t b,
+                                        uint8_t w, uint8_t idle) {
+  channelmA[0] = r;
+  channelmA[1] = g;
+  channelmA[2] = b;
+  channelmA[3] = w;
+  idlemA = idle;
+}
+
+/*!
+  @brief   Estimate the current the strip will draw when the pixel data
+           presently in RAM is shown, based on the model set with
+           setCurrentModel(). Current is assumed linear with each element's
+           PWM value, which is close enough for power budgeting.
+  @return  Estimated current in milliamps.
+*/
+uint32_t Adafruit_NeoPixel::estimateCurrent(void) const {
+  uint32_t r = 0, g = 0, b = 0, w = 0;
+  const uint8_t *p = pixels;
+  if (wOffset == rOffset) { // Is an RGB-type strip
+    for (uint16_t i = 0; i < numLEDs; i++, p += 3) {
+      r += p[rOffset];
+      g += p[gOffset];
+      b += p[bOffset];
+    }
+  } else { // Is a WRGB-type strip
+    for (uint16_t i = 0; i < numLEDs; i++, p += 4) {
+      r += p[rOffset];
+      g += p[gOffset];
+      b += p[bOffset];
+      w += p[wOffset];
+    }
+  }
+  // Each sum times its mA fits in 32 bits, but not all four added, so
+  // scale each down first
+  return (r * channelmA[0]) / 255 + (g * channelmA[1]) / 255 +
+         (b * channelmA[2]) / 255 + (w * channelmA[3]) / 255 +
+         (uint32_t)numLEDs * idlemA;
+}
+
+// Private, called from show(). If the frame in RAM would exceed the
+// power budget, return a copy scaled to fit (in the buffer allocated by
+// setMaxCurrent()), else NULL.
+uint8_t *Adafruit_NeoPixel::limitCurrent(void) {
+  if (!maxCurrent || !pixels || !limitBuf)
+    return NULL;
+  uint32_t estimate = estimateCurrent();
+  if (estimate <= maxCurrent)
+    return NULL;
+
+  // Idle current can't be dimmed, only the portion above it.
+  uint32_t idle = (uint32_t)numLEDs * idlemA;
+  uint16_t scale = 0; // 0-255, 8-bit fixed-point fraction
+  if (maxCurrent > idle)
+    scale = ((maxCurrent - idle) << 8) / (estimate - idle);
+
+  for (uint16_t i = 0; i < numBytes; i++)
+    limitBuf[i] = (pixels[i] * scale) >> 8;
+  return limitBuf;
+}
+
 #if defined(ARDUINO_ARCH_CH32)
 
 // F_CPU is defined to SystemCoreClock (not constant number)
@@ -385,10 +557,18 @@ static void ch32Show(GPIO_TypeDef* ch_port, uint32_t ch_pin, uint8_t* pixels, ui
 #if defined(ESP8266)
 // ESP8266 show() is external to enforce ICACHE_RAM_ATTR execution
 extern "C" IRAM_ATTR void espShow(uint16_t pin, uint8_t *pixels,
-                                  uint32_t numBytes, uint8_t type);
+                                  uint32_t numBytes, uint16_t t0h,
+                                  uint16_t t1h, uint16_t period);
 #elif defined(ESP32)
 extern "C" void espShow(uint16_t pin, uint8_t *pixels, uint32_t numBytes,
-                        uint8_t type);
+                        uint16_t t0h, uint16_t t1h, uint16_t period);
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+// Pre-encoded frames are RMT symbols, 4 bytes per bit
+extern "C" void espEncode(uint8_t *pixels, uint32_t numBytes, uint16_t t0h,
+                          uint16_t t1h, uint16_t period, void *symbols);
+extern "C" void espShowEncoded(uint16_t pin, void *symbols,
+                               uint32_t numSymbols);
+#endif
 
 #endif // ESP8266
 
@@ -398,10 +578,171 @@ extern "C" void espShow(uint16_t pin, uint8_t *pixels, uint32_t numBytes,
 
 #if defined(KENDRYTE_K210)
 extern "C" void k210Show(uint8_t pin, uint8_t *pixels, uint32_t numBytes,
-                         boolean is800KHz);
+                         uint16_t t0h, uint16_t t1h, uint16_t period);
 #endif // KENDRYTE_K210
 
 
+#if defined(NRF52) || defined(NRF52_SERIES)
+// [[[Begin of the Neopixel NRF52 EasyDMA implementation
+//                                    by the Hackerspace San Salvador]]]
+// This technique uses the PWM peripheral on the NRF52. The PWM uses the
+// EasyDMA feature included on the chip. This technique loads the duty
+// cycle configuration for each cycle when the PWM is enabled. For this
+// to work we need to store a 16 bit configuration for each bit of the
+// RGB(W) values in the pixel buffer.
+// Comparator values for the PWM are derived from the strip's bit timing
+// (see setChip() and setTiming()), rounded to the nearest PWM step:
+//   * PWM Clock: 16Mhz
+//   * Minimum step time: 62.5ns
+// e.g. for the default WS2812B timing (0.4us, 0.8us, 1.25us period) this
+// yields T0H = 6 steps (0.375us), T1H = 13 (0.8125us), CTOPVAL = 20; for
+// 400Khz WS2811 timing (0.5us, 1.2us, 2.5us), 8, 19 and 40.
+// ---------- BEGIN Constants for the EasyDMA implementation -----------
+// The PWM starts the duty cycle in LOW. To start with HIGH we
+// need to set the 15th bit on each register.
+#define NRF52_PWM_STEPS(ns) ((((uint32_t)(ns)) * 16 + 500) / 1000)
+// ---------- END Constants for the EasyDMA implementation -------------
+
+// Try to find a free PWM device, which is not enabled
+// and has no connected pins. Returns NULL if none is free.
+static NRF_PWM_Type *nrf52FindPWM(void) {
+  NRF_PWM_Type *PWM[] = {
+    NRF_PWM0,
+    NRF_PWM1,
+    NRF_PWM2
+#if defined(NRF_PWM3)
+    ,
+    NRF_PWM3
+#endif
+  };
+
+  for (unsigned int device = 0; device < (sizeof(PWM) / sizeof(PWM[0]));
+       device++) {
+    if ((PWM[device]->ENABLE == 0) &&
+        (PWM[device]->PSEL.OUT[0] & PWM_PSEL_OUT_CONNECT_Msk) &&
+        (PWM[device]->PSEL.OUT[1] & PWM_PSEL_OUT_CONNECT_Msk) &&
+        (PWM[device]->PSEL.OUT[2] & PWM_PSEL_OUT_CONNECT_Msk) &&
+        (PWM[device]->PSEL.OUT[3] & PWM_PSEL_OUT_CONNECT_Msk)) {
+      return PWM[device];
+    }
+  }
+  return NULL;
+}
+
+// The actual memory used in bytes for the pattern corresponds to the
+// following formula:
+//              totalMem = numBytes*8*2+(2*2)
+// The two additional bytes at the end are needed to reset the
+// sequence.
+static uint32_t nrf52PatternSize(uint32_t numBytes) {
+  return numBytes * 8 * sizeof(uint16_t) + 2 * sizeof(uint16_t);
+}
+
+// Convert pixel data to the PWM duty cycle pattern, one comparator value
+// per bit, with T0H and T1H in nanoseconds. Doesn't terminate the pattern
+// (see nrf52EndPattern()), so may also be used to re-encode part of one.
+static void nrf52Encode(uint16_t *pixels_pattern, const uint8_t *pixels,
+                        uint32_t numBytes, uint16_t t0h, uint16_t t1h) {
+  uint32_t pos = 0; // bit position
+  uint16_t magicT0H = NRF52_PWM_STEPS(t0h) | 0x8000,
+           magicT1H = NRF52_PWM_STEPS(t1h) | 0x8000;
+
+  for (uint32_t n = 0; n < numBytes; n++) {
+    uint8_t pix = pixels[n];
+
+    for (uint8_t mask = 0x80; mask > 0; mask >>= 1) {
+      pixels_pattern[pos] = (pix & mask) ? magicT1H : magicT0H;
+      pos++;
+    }
+  }
+}
+
+// Append the end words to a pattern of numBytes of pixel data.
+static void nrf52EndPattern(uint16_t *pixels_pattern, uint32_t numBytes) {
+  uint32_t pos = numBytes * 8;
+  // Zero padding to indicate the end of que sequence
+  pixels_pattern[pos++] = 0 | (0x8000); // Seq end
+  pixels_pattern[pos++] = 0 | (0x8000); // Seq end
+}
+
+// Issue a pattern from nrf52Encode() on the given PWM device and pin,
+// with the bit period in nanoseconds. Returns when transmission is done.
+static void nrf52Play(NRF_PWM_Type *pwm, int16_t pin, uint16_t *pixels_pattern,
+                      uint32_t pattern_size, uint16_t period) {
+  // Set the wave mode to count UP
+  pwm->MODE = (PWM_MODE_UPDOWN_Up << PWM_MODE_UPDOWN_Pos);
+
+  // Set the PWM to use the 16MHz clock
+  pwm->PRESCALER =
+      (PWM_PRESCALER_PRESCALER_DIV_1 << PWM_PRESCALER_PRESCALER_Pos);
+
+  // Setting of the maximum count
+  // but keeping it on 16Mhz allows for more granularity just
+  // in case someone wants to do more fine-tuning of the timing.
+  pwm->COUNTERTOP =
+      (NRF52_PWM_STEPS(period) << PWM_COUNTERTOP_COUNTERTOP_Pos);
+
+  // Disable loops, we want the sequence to repeat only once
+  pwm->LOOP = (PWM_LOOP_CNT_Disabled << PWM_LOOP_CNT_Pos);
+
+  // On the "Common" setting the PWM uses the same pattern for the
+  // for supported sequences. The pattern is stored on half-word
+  // of 16bits
+  pwm->DECODER = (PWM_DECODER_LOAD_Common << PWM_DECODER_LOAD_Pos) |
+                 (PWM_DECODER_MODE_RefreshCount << PWM_DECODER_MODE_Pos);
+
+  // Pointer to the memory storing the patter
+  pwm->SEQ[0].PTR = (uint32_t)(pixels_pattern) << PWM_SEQ_PTR_PTR_Pos;
+
+  // Calculation of the number of steps loaded from memory.
+  pwm->SEQ[0].CNT = (pattern_size / sizeof(uint16_t)) << PWM_SEQ_CNT_CNT_Pos;
+
+  // The following settings are ignored with the current config.
+  pwm->SEQ[0].REFRESH = 0;
+  pwm->SEQ[0].ENDDELAY = 0;
+
+  // The Neopixel implementation is a blocking algorithm. DMA
+  // allows for non-blocking operation. To "simulate" a blocking
+  // operation we enable the interruption for the end of sequence
+  // and block the execution thread until the event flag is set by
+  // the peripheral.
+  //    pwm->INTEN |= (PWM_INTEN_SEQEND0_Enabled<<PWM_INTEN_SEQEND0_Pos);
+
+// PSEL must be configured before enabling PWM
+#if defined(ARDUINO_ARCH_NRF52840)
+  pwm->PSEL.OUT[0] = g_APinDescription[pin].name;
+#else
+  pwm->PSEL.OUT[0] = g_ADigitalPinMap[pin];
+#endif
+
+  // Enable the PWM
+  pwm->ENABLE = 1;
+
+  // After all of this and many hours of reading the documentation
+  // we are ready to start the sequence...
+  pwm->EVENTS_SEQEND[0] = 0;
+  pwm->TASKS_SEQSTART[0] = 1;
+
+  // But we have to wait for the flag to be set.
+  while (!pwm->EVENTS_SEQEND[0]) {
+#if defined(ARDUINO_NRF52_ADAFRUIT) || defined(ARDUINO_ARCH_NRF52840)
+    yield();
+#endif
+  }
+
+  // Before leave we clear the flag for the event.
+  pwm->EVENTS_SEQEND[0] = 0;
+
+  // We need to disable the device and disconnect
+  // all the outputs before leave or the device will not
+  // be selected on the next call.
+  // TODO: Check if disabling the device causes performance issues.
+  pwm->ENABLE = 0;
+
+  pwm->PSEL.OUT[0] = 0xFFFFFFFFUL;
+}
+#endif // NRF52
+
 #if defined(ARDUINO_ARCH_PSOC6)
 extern "C" void psoc6_show(uint8_t pin, uint8_t *pixels, uint32_t numBytes,
                          boolean is800KHz);
@@ -422,14 +763,28 @@ void Adafruit_NeoPixel::show(void) {
   if (!pixels)
     return;
 
-  // Data latch = 300+ microsecond pause in the output stream. Rather than
-  // put a delay at the end of the function, the ending time is noted and
-  // the function will simply hold off (if needed) on issuing the
-  // subsequent round of data until the latch time has elapsed. This
-  // allows the mainline code to start generating the next frame of data
-  // rather than stalling for the latch.
+  // Data latch = 300+ microsecond (or per setLatchTime()) pause in the
+  // output stream. Rather than put a delay at the end of the function,
+  // the ending time is noted and the function will simply hold off (if
+  // needed) on issuing the subsequent round of data until the latch time
+  // has elapsed. This allows the mainline code to start generating the
+  // next frame of data rather than stalling for the latch.
+  // If a power budget is set and this frame would exceed it, a scaled-
+  // down copy is issued in place of the real pixel data (which is left
+  // untouched for the next frame). This is figured before the latch wait
+  // so any idle time there isn't wasted.
+  uint8_t *unlimited = pixels, *limited = limitCurrent();
+  if (limited)
+    pixels = limited;
+
+#if defined(NEO_SHOW_STATS)
+  uint32_t statStart = micros();
+#endif
   while (!canShow())
     ;
+#if defined(NEO_SHOW_STATS)
+  uint32_t statLatched = micros();
+#endif
     // endTime is a private member (rather than global var) so that multiple
     // instances on different pins can be quickly issued in succession (each
     // instance doesn't delay the next).
@@ -2117,52 +2472,16 @@ void Adafruit_NeoPixel::show(void) {
   // Begin of support for nRF52 based boards  -------------------------
 
 #elif defined(NRF52) || defined(NRF52_SERIES)
-// [[[Begin of the Neopixel NRF52 EasyDMA implementation
-//                                    by the Hackerspace San Salvador]]]
-// This technique uses the PWM peripheral on the NRF52. The PWM uses the
-// EasyDMA feature included on the chip. This technique loads the duty
-// cycle configuration for each cycle when the PWM is enabled. For this
-// to work we need to store a 16 bit configuration for each bit of the
-// RGB(W) values in the pixel buffer.
-// Comparator values for the PWM were hand picked and are guaranteed to
-// be 100% organic to preserve freshness and high accuracy. Current
-// parameters are:
-//   * PWM Clock: 16Mhz
-//   * Minimum step time: 62.5ns
-//   * Time for zero in high (T0H): 0.31ms
-//   * Time for one in high (T1H): 0.75ms
-//   * Cycle time:  1.25us
-//   * Frequency: 800Khz
-// For 400Khz we just double the calculated times.
-// ---------- BEGIN Constants for the EasyDMA implementation -----------
-// The PWM starts the duty cycle in LOW. To start with HIGH we
-// need to set the 15th bit on each register.
-
-// WS2812 (rev A) timing is 0.35 and 0.7us
-//#define MAGIC_T0H               5UL | (0x8000) // 0.3125us
-//#define MAGIC_T1H              12UL | (0x8000) // 0.75us
-
-// WS2812B (rev B) timing is 0.4 and 0.8 us
-#define MAGIC_T0H 6UL | (0x8000) // 0.375us
-#define MAGIC_T1H 13UL | (0x8000) // 0.8125us
-
-// WS2811 (400 khz) timing is 0.5 and 1.2
-#define MAGIC_T0H_400KHz 8UL | (0x8000) // 0.5us
-#define MAGIC_T1H_400KHz 19UL | (0x8000) // 1.1875us
-
-// For 400Khz, we double value of CTOPVAL
-#define CTOPVAL 20UL // 1.25us
-#define CTOPVAL_400KHz 40UL // 2.5us
-
-// ---------- END Constants for the EasyDMA implementation -------------
-//
-// If there is no device available an alternative cycle-counter
+// If there is no PWM device available for the EasyDMA implementation
+// (see nrf52FindPWM() above), an alternative cycle-counter
 // implementation is tried.
 // The nRF52 runs with a fixed clock of 64Mhz. The alternative
 // implementation is the same as the one used for the Teensy 3.0/1/2 but
 // with the Nordic SDK HAL & registers syntax.
 // The number of cycles was hand picked and is guaranteed to be 100%
-// organic to preserve freshness and high accuracy.
+// organic to preserve freshness and high accuracy. The 800 KHz values
+// (which allow for loop overhead) are for WS2812B timing, and are scaled
+// proportionally for other chips' timing.
 // ---------- BEGIN Constants for cycle counter implementation ---------
 #define CYCLES_800_T0H 18 // ~0.36 uS
 #define CYCLES_800_T1H 41 // ~0.76 uS
@@ -2175,43 +2494,15 @@ void Adafruit_NeoPixel::show(void) {
 
   // To support both the SoftDevice + Neopixels we use the EasyDMA
   // feature from the NRF25. However this technique implies to
-  // generate a pattern and store it on the memory. The actual
-  // memory used in bytes corresponds to the following formula:
-  //              totalMem = numBytes*8*2+(2*2)
-  // The two additional bytes at the end are needed to reset the
-  // sequence.
+  // generate a pattern and store it on the memory (see
+  // nrf52PatternSize() for how much).
   //
   // If there is not enough memory, we will fall back to cycle counter
   // using DWT
-  uint32_t pattern_size =
-      numBytes * 8 * sizeof(uint16_t) + 2 * sizeof(uint16_t);
+  uint32_t pattern_size = nrf52PatternSize(numBytes);
   uint16_t *pixels_pattern = NULL;
 
-  NRF_PWM_Type *pwm = NULL;
-
-  // Try to find a free PWM device, which is not enabled
-  // and has no connected pins
-  NRF_PWM_Type *PWM[] = {
-    NRF_PWM0,
-    NRF_PWM1,
-    NRF_PWM2
-#if defined(NRF_PWM3)
-    ,
-    NRF_PWM3
-#endif
-  };
-
-  for (unsigned int device = 0; device < (sizeof(PWM) / sizeof(PWM[0]));
-       device++) {
-    if ((PWM[device]->ENABLE == 0) &&
-        (PWM[device]->PSEL.OUT[0] & PWM_PSEL_OUT_CONNECT_Msk) &&
-        (PWM[device]->PSEL.OUT[1] & PWM_PSEL_OUT_CONNECT_Msk) &&
-        (PWM[device]->PSEL.OUT[2] & PWM_PSEL_OUT_CONNECT_Msk) &&
-        (PWM[device]->PSEL.OUT[3] & PWM_PSEL_OUT_CONNECT_Msk)) {
-      pwm = PWM[device];
-      break;
-    }
-  }
+  NRF_PWM_Type *pwm = nrf52FindPWM();
 
   // only malloc if there is PWM device available
   if (pwm != NULL) {
@@ -2225,107 +2516,10 @@ void Adafruit_NeoPixel::show(void) {
   // Use the identified device to choose the implementation
   // If a PWM device is available use DMA
   if ((pixels_pattern != NULL) && (pwm != NULL)) {
-    uint16_t pos = 0; // bit position
-
-    for (uint16_t n = 0; n < numBytes; n++) {
-      uint8_t pix = pixels[n];
-
-      for (uint8_t mask = 0x80; mask > 0; mask >>= 1) {
-#if defined(NEO_KHZ400)
-        if (!is800KHz) {
-          pixels_pattern[pos] =
-              (pix & mask) ? MAGIC_T1H_400KHz : MAGIC_T0H_400KHz;
-        } else
-#endif
-        {
-          pixels_pattern[pos] = (pix & mask) ? MAGIC_T1H : MAGIC_T0H;
-        }
-
-        pos++;
-      }
-    }
-
-    // Zero padding to indicate the end of que sequence
-    pixels_pattern[pos++] = 0 | (0x8000); // Seq end
-    pixels_pattern[pos++] = 0 | (0x8000); // Seq end
-
-    // Set the wave mode to count UP
-    pwm->MODE = (PWM_MODE_UPDOWN_Up << PWM_MODE_UPDOWN_Pos);
-
-    // Set the PWM to use the 16MHz clock
-    pwm->PRESCALER =
-        (PWM_PRESCALER_PRESCALER_DIV_1 << PWM_PRESCALER_PRESCALER_Pos);
-
-    // Setting of the maximum count
-    // but keeping it on 16Mhz allows for more granularity just
-    // in case someone wants to do more fine-tuning of the timing.
-#if defined(NEO_KHZ400)
-    if (!is800KHz) {
-      pwm->COUNTERTOP = (CTOPVAL_400KHz << PWM_COUNTERTOP_COUNTERTOP_Pos);
-    } else
-#endif
-    {
-      pwm->COUNTERTOP = (CTOPVAL << PWM_COUNTERTOP_COUNTERTOP_Pos);
-    }
-
-    // Disable loops, we want the sequence to repeat only once
-    pwm->LOOP = (PWM_LOOP_CNT_Disabled << PWM_LOOP_CNT_Pos);
-
-    // On the "Common" setting the PWM uses the same pattern for the
-    // for supported sequences. The pattern is stored on half-word
-    // of 16bits
-    pwm->DECODER = (PWM_DECODER_LOAD_Common << PWM_DECODER_LOAD_Pos) |
-                   (PWM_DECODER_MODE_RefreshCount << PWM_DECODER_MODE_Pos);
-
-    // Pointer to the memory storing the patter
-    pwm->SEQ[0].PTR = (uint32_t)(pixels_pattern) << PWM_SEQ_PTR_PTR_Pos;
-
-    // Calculation of the number of steps loaded from memory.
-    pwm->SEQ[0].CNT = (pattern_size / sizeof(uint16_t)) << PWM_SEQ_CNT_CNT_Pos;
-
-    // The following settings are ignored with the current config.
-    pwm->SEQ[0].REFRESH = 0;
-    pwm->SEQ[0].ENDDELAY = 0;
-
-    // The Neopixel implementation is a blocking algorithm. DMA
-    // allows for non-blocking operation. To "simulate" a blocking
-    // operation we enable the interruption for the end of sequence
-    // and block the execution thread until the event flag is set by
-    // the peripheral.
-    //    pwm->INTEN |= (PWM_INTEN_SEQEND0_Enabled<<PWM_INTEN_SEQEND0_Pos);
-
-// PSEL must be configured before enabling PWM
-#if defined(ARDUINO_ARCH_NRF52840)
-    pwm->PSEL.OUT[0] = g_APinDescription[pin].name;
-#else
-    pwm->PSEL.OUT[0] = g_ADigitalPinMap[pin];
-#endif
-
-    // Enable the PWM
-    pwm->ENABLE = 1;
-
-    // After all of this and many hours of reading the documentation
-    // we are ready to start the sequence...
-    pwm->EVENTS_SEQEND[0] = 0;
-    pwm->TASKS_SEQSTART[0] = 1;
-
-    // But we have to wait for the flag to be set.
-    while (!pwm->EVENTS_SEQEND[0]) {
-#if defined(ARDUINO_NRF52_ADAFRUIT) || defined(ARDUINO_ARCH_NRF52840)
-      yield();
-#endif
-    }
-
-    // Before leave we clear the flag for the event.
-    pwm->EVENTS_SEQEND[0] = 0;
-
-    // We need to disable the device and disconnect
-    // all the outputs before leave or the device will not
-    // be selected on the next call.
-    // TODO: Check if disabling the device causes performance issues.
-    pwm->ENABLE = 0;
-
-    pwm->PSEL.OUT[0] = 0xFFFFFFFFUL;
+    const neoPixelTiming t = bitTiming();
+    nrf52Encode(pixels_pattern, pixels, numBytes, t.t0h, t.t1h);
+    nrf52EndPattern(pixels_pattern, numBytes);
+    nrf52Play(pwm, pin, pixels_pattern, pattern_size, t.period);
 
 #if defined(ARDUINO_NRF52_ADAFRUIT) // use thread-safe free
     rtos_free(pixels_pattern);
@@ -2353,9 +2547,10 @@ void Adafruit_NeoPixel::show(void) {
     NRF_GPIO_Type *nrf_port = (NRF_GPIO_Type *)digitalPinToPort(pin);
     uint32_t pinMask = digitalPinToBitMask(pin);
 
-    uint32_t CYCLES_X00 = CYCLES_800;
-    uint32_t CYCLES_X00_T1H = CYCLES_800_T1H;
-    uint32_t CYCLES_X00_T0H = CYCLES_800_T0H;
+    const neoPixelTiming t = bitTiming();
+    uint32_t CYCLES_X00 = CYCLES_800 * t.period / 1250;
+    uint32_t CYCLES_X00_T1H = CYCLES_800_T1H * t.t1h / 800;
+    uint32_t CYCLES_X00_T0H = CYCLES_800_T0H * t.t0h / 400;
 
 #if defined(NEO_KHZ400)
     if (!is800KHz) {
@@ -2406,8 +2601,8 @@ void Adafruit_NeoPixel::show(void) {
         break;
       }
 
-      // re-send need 300us delay
-      delayMicroseconds(300);
+      // re-send needs a latch delay
+      delayMicroseconds(timing.latch);
     }
 
 // Enable interrupts again
@@ -3210,11 +3405,13 @@ if(is800KHz) {
   // ESP8266 ----------------------------------------------------------------
 
   // ESP8266 show() is external to enforce ICACHE_RAM_ATTR execution
-  espShow(pin, pixels, numBytes, is800KHz);
+  const neoPixelTiming &t = bitTiming();
+  espShow(pin, pixels, numBytes, t.t0h, t.t1h, t.period);
 
 #elif defined(KENDRYTE_K210)
 
-  k210Show(pin, pixels, numBytes, is800KHz);
+  const neoPixelTiming &t = bitTiming();
+  k210Show(pin, pixels, numBytes, t.t0h, t.t1h, t.period);
 
 #elif defined(__ARDUINO_ARC__)
 
@@ -3327,7 +3524,231 @@ if(is800KHz) {
   interrupts();
 #endif
 
+  if (limited)
+    pixels = unlimited;
+
   endTime = micros(); // Save EOD time for latch on next call
+
+#if defined(NEO_SHOW_STATS)
+  updateStats(statStart, statLatched);
+#endif
+}
+
+#if defined(NEO_SHOW_STATS)
+// Private, called at end of show(). 'start' is micros() on entry to the
+// latch wait, 'latched' is micros() once the latch time had elapsed and
+// transmission began; endTime holds micros() at end of transmission.
+void Adafruit_NeoPixel::updateStats(uint32_t start, uint32_t latched) {
+  uint32_t wait = latched - start, xmit = endTime - latched, irq = 0;
+
+#if !(defined(NRF52) || defined(NRF52_SERIES) || defined(ESP32))
+  // Interrupts were off for the whole transmission, during which micros()
+  // doesn't advance (or only partly), so the measured time is low. Use
+  // the known wire time instead: 8 bits per byte at the bit period.
+  irq = (uint32_t)numBytes * 8 * bitTiming().period / 1000;
+  if (xmit < irq)
+    xmit = irq;
+#endif
+
+  if (stats.shows) {
+    // Running average over roughly the last 8 frames
+    uint32_t interval = start - stats.lastShow;
+    if (stats.frameInterval)
+      stats.frameInterval += ((int32_t)(interval - stats.frameInterval)) / 8;
+    else
+      stats.frameInterval = interval;
+  }
+  stats.lastShow = start;
+  stats.shows++;
+  stats.latchWait += wait;
+  if (wait > stats.latchWaitMax)
+    stats.latchWaitMax = wait;
+  stats.transmit += xmit;
+  if (xmit > stats.transmitMax)
+    stats.transmitMax = xmit;
+  stats.irqOff += irq;
+  if (irq > stats.irqOffMax)
+    stats.irqOffMax = irq;
+}
+
+/*!
+  @brief   Clear all timing statistics accumulated by show(). Only
+           available if NEO_SHOW_STATS is defined in Adafruit_NeoPixel.h.
+*/
+void Adafruit_NeoPixel::resetStats(void) { memset(&stats, 0, sizeof stats); }
+
+/*!
+  @brief   Report the rate at which show() is being called. Only available
+           if NEO_SHOW_STATS is defined in Adafruit_NeoPixel.h.
+  @return  Frames per second, averaged over roughly the last 8 frames, or
+           0 if fewer than two frames have been shown.
+*/
+uint16_t Adafruit_NeoPixel::getFPS(void) const {
+  return stats.frameInterval ? (1000000UL / stats.frameInterval) : 0;
+}
+#endif
+
+/*!
+  @brief   Transmit pixel data in RAM to NeoPixels, but only if this can
+           start immediately. Unlike show(), this never waits out the data
+           latch interval; if called too soon after the prior show(), it
+           returns at once so the caller can get on with other work (see
+           latchRemaining() for how long to wait).
+  @return  true if data was sent, false if the latch interval had not yet
+           elapsed and nothing was done.
+*/
+bool Adafruit_NeoPixel::tryShow(void) {
+  if (!canShow())
+    return false;
+  show();
+  return true;
+}
+
+/*!
+  @brief   Capture the current pixel data (after brightness and current
+           limiting, if set) as a frame that can be issued repeatedly with
+           showEncoded(), skipping the per-show() conversion to the output
+           peripheral's bitstream on architectures that have one (nRF52,
+           ESP32 with ESP-IDF 5). Useful for cycling through a few fixed
+           frames, e.g. blink or alert patterns.
+  @param   frame  neoPixelFrame to fill in: either empty (zero-initialized,
+                  e.g. neoPixelFrame frame = {};) or from a prior
+                  encodeFrame(), which is released first, so a frame can
+                  be encoded again in place. Release with freeFrame() when
+                  no longer needed.
+  @return  true on success, false if there's insufficient RAM (frame is
+           then empty and showEncoded() ignores it).
+  @note    The bitstream uses the bit timing in effect when encoded; after
+           setChip() or setTiming(), encode frames again. Encoded frames
+           use 16 (nRF52) or 32 (ESP32) bytes of RAM per pixel byte.
+*/
+bool Adafruit_NeoPixel::encodeFrame(neoPixelFrame &frame) {
+  freeFrame(frame); // Fields are NULL if empty, so this is safe
+  uint32_t encodedSize = 0;
+#if defined(NRF52) || defined(NRF52_SERIES)
+  encodedSize = nrf52PatternSize(numBytes);
+#elif defined(ESP32)
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+  encodedSize = (uint32_t)numBytes * 8 * 4; // One 32-bit RMT symbol per bit
+#endif
+#endif
+
+  // Bitstream and pixel data share one allocation, bitstream first so
+  // it keeps malloc()'s alignment
+  uint8_t *buf = (uint8_t *)malloc(encodedSize + numBytes);
+  frame.pixels = buf ? buf + encodedSize : NULL;
+  frame.encoded = (buf && encodedSize) ? buf : NULL;
+  frame.encodedSize = buf ? encodedSize : 0;
+  frame.numBytes = buf ? numBytes : 0;
+  if (!buf)
+    return false;
+
+#if defined(NRF52) || defined(NRF52_SERIES)
+  nrf52EndPattern((uint16_t *)frame.encoded, numBytes);
+#endif
+  return updateFrame(frame);
+}
+
+/*!
+  @brief   Re-encode part of a frame from encodeFrame() to match the
+           current pixel data, e.g. after an animation delta changed only
+           some pixels. Cheaper than a new encodeFrame() by the fraction
+           of pixels skipped, and allocates no RAM.
+  @param   frame  Frame from encodeFrame(), for this strip.
+  @param   first  Index of first pixel to re-encode, starting from 0.
+  @param   count  Number of pixels to re-encode, clipped to the end of the
+                  strip. 0 does nothing (e.g. a frame from
+                  Adafruit_NeoPixel_Player that changed no pixels).
+  @return  true on success, false if frame is empty or the strip length
+           has changed since it was encoded.
+  @note    If a current limit is set (setMaxCurrent()), the whole frame is
+           re-encoded, since any change may alter the scale of all pixels.
+           Pixels outside the range keep their prior bit timing.
+*/
+bool Adafruit_NeoPixel::updateFrame(neoPixelFrame &frame, uint16_t first,
+                                    uint16_t count) {
+  if (!frame.pixels || (frame.numBytes != numBytes))
+    return false;
+  if (!count || (first >= numLEDs))
+    return true;
+  if (maxCurrent) {
+    first = 0;
+    count = numLEDs;
+  }
+  if (count > (numLEDs - first))
+    count = numLEDs - first;
+
+  uint8_t bytesPerPixel = (wOffset == rOffset) ? 3 : 4;
+  uint32_t offset = (uint32_t)first * bytesPerPixel,
+           bytes = (uint32_t)count * bytesPerPixel;
+  uint8_t *limited = limitCurrent();
+  memcpy(frame.pixels + offset, (limited ? limited : pixels) + offset, bytes);
+
+#if defined(NRF52) || defined(NRF52_SERIES)
+  const neoPixelTiming t = bitTiming();
+  nrf52Encode((uint16_t *)frame.encoded + offset * 8, frame.pixels + offset,
+              bytes, t.t0h, t.t1h);
+#elif defined(ESP32)
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+  const neoPixelTiming t = bitTiming();
+  espEncode(frame.pixels + offset, bytes, t.t0h, t.t1h, t.period,
+            (uint8_t *)frame.encoded + offset * 8 * 4);
+#endif
+#endif
+  return true;
+}
+
+/*!
+  @brief   Transmit a frame made by encodeFrame() to the NeoPixels. Like
+           show(), waits for the latch interval since the prior update,
+           but the pixel buffer is neither used nor changed.
+  @param   frame  Frame from encodeFrame(). Ignored if empty or if the
+                  strip length has changed since it was encoded.
+*/
+void Adafruit_NeoPixel::showEncoded(const neoPixelFrame &frame) {
+  if (!frame.pixels || (frame.numBytes != numBytes))
+    return;
+
+#if defined(NRF52) || defined(NRF52_SERIES)
+  NRF_PWM_Type *pwm = frame.encoded ? nrf52FindPWM() : NULL;
+  if (pwm != NULL) {
+    while (!canShow())
+      ;
+    nrf52Play(pwm, pin, (uint16_t *)frame.encoded, frame.encodedSize,
+              bitTiming().period);
+    endTime = micros();
+    return;
+  }
+#elif defined(ESP32)
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+  if (frame.encoded) {
+    while (!canShow())
+      ;
+    espShowEncoded(pin, frame.encoded, frame.encodedSize / 4);
+    endTime = micros();
+    return;
+  }
+#endif
+#endif
+
+  // No bitstream for this architecture (or no PWM device free to play
+  // it), issue the saved pixel data the usual way
+  uint8_t *saved = pixels;
+  pixels = frame.pixels;
+  show();
+  pixels = saved;
+}
+
+/*!
+  @brief   Release the RAM used by a frame from encodeFrame().
+  @param   frame  Frame to release, left empty afterward.
+*/
+void Adafruit_NeoPixel::freeFrame(neoPixelFrame &frame) {
+  free(frame.encoded ? frame.encoded : frame.pixels);
+  frame.pixels = NULL;
+  frame.encoded = NULL;
+  frame.encodedSize = 0;
+  frame.numBytes = 0;
 }
 
 /*!
@@ -3377,17 +3798,15 @@ void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint8_t r, uint8_t g,
                                       uint8_t b) {
 
   if (n < numLEDs) {
-    if (brightness) { // See notes in setBrightness()
-      r = (r * brightness) >> 8;
-      g = (g * brightness) >> 8;
-      b = (b * brightness) >> 8;
-    }
     uint8_t *p;
     if (wOffset == rOffset) { // Is an RGB-type strip
-      p = &pixels[n * 3];     // 3 bytes per pixel
-    } else {                  // Is a WRGB-type strip
-      p = &pixels[n * 4];     // 4 bytes per pixel
-      p[wOffset] = 0;         // But only R,G,B passed -- set W to 0
+      scaleColor(r, g, b);
+      p = &pixels[n * 3]; // 3 bytes per pixel
+    } else {              // Is a WRGB-type strip
+      uint8_t w = 0;      // Only R,G,B passed, but see setWhiteExtraction()
+      scaleColor(r, g, b, w);
+      p = &pixels[n * 4]; // 4 bytes per pixel
+      p[wOffset] = w;     // Store W
     }
     p[rOffset] = r; // R,G,B always stored
     p[gOffset] = g;
@@ -3409,18 +3828,14 @@ void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint8_t r, uint8_t g,
                                       uint8_t b, uint8_t w) {
 
   if (n < numLEDs) {
-    if (brightness) { // See notes in setBrightness()
-      r = (r * brightness) >> 8;
-      g = (g * brightness) >> 8;
-      b = (b * brightness) >> 8;
-      w = (w * brightness) >> 8;
-    }
     uint8_t *p;
     if (wOffset == rOffset) { // Is an RGB-type strip
-      p = &pixels[n * 3];     // 3 bytes per pixel (ignore W)
-    } else {                  // Is a WRGB-type strip
-      p = &pixels[n * 4];     // 4 bytes per pixel
-      p[wOffset] = w;         // Store W
+      scaleColor(r, g, b);
+      p = &pixels[n * 3]; // 3 bytes per pixel (ignore W)
+    } else {              // Is a WRGB-type strip
+      scaleColor(r, g, b, w);
+      p = &pixels[n * 4]; // 4 bytes per pixel
+      p[wOffset] = w;     // Store W
     }
     p[rOffset] = r; // Store R,G,B
     p[gOffset] = g;
@@ -3438,17 +3853,14 @@ void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint8_t r, uint8_t g,
 void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint32_t c) {
   if (n < numLEDs) {
     uint8_t *p, r = (uint8_t)(c >> 16), g = (uint8_t)(c >> 8), b = (uint8_t)c;
-    if (brightness) { // See notes in setBrightness()
-      r = (r * brightness) >> 8;
-      g = (g * brightness) >> 8;
-      b = (b * brightness) >> 8;
-    }
     if (wOffset == rOffset) {
+      scaleColor(r, g, b);
       p = &pixels[n * 3];
     } else {
-      p = &pixels[n * 4];
       uint8_t w = (uint8_t)(c >> 24);
-      p[wOffset] = brightness ? ((w * brightness) >> 8) : w;
+      scaleColor(r, g, b, w);
+      p = &pixels[n * 4];
+      p[wOffset] = w;
     }
     p[rOffset] = r;
     p[gOffset] = g;
@@ -3490,6 +3902,48 @@ void Adafruit_NeoPixel::fill(uint32_t c, uint16_t first, uint16_t count) {
   }
 }
 
+/*!
+  @brief   Copy a run of color channel values, in R,G,B (or R,G,B,W for
+           RGBW strips) order, into the pixel buffer, reordering for the
+           strip's color order and applying brightness and color
+           correction as setPixelColor() does. For network and serial
+           protocols that carry a strip as a flat array of channels.
+  @param   channel  Index of first channel, starting from 0 (red of the
+                    first pixel). Needn't fall on a pixel boundary.
+  @param   data     Channel values.
+  @param   length   Number of channels. Channels past the end of the strip
+                    are ignored.
+  @note    If the strip's color order is NEO_RGB or NEO_RGBW and no
+           brightness or color correction is set, this is a straight
+           memcpy().
+*/
+void Adafruit_NeoPixel::setChannels(uint32_t channel, const uint8_t *data,
+                                    uint32_t length) {
+  if (channel >= numBytes)
+    return;
+  if (length > (numBytes - channel))
+    length = numBytes - channel;
+
+  uint8_t bytesPerPixel = (wOffset == rOffset) ? 3 : 4;
+  if (!scaled && (rOffset == 0) && (gOffset == 1) && (bOffset == 2)) {
+    memcpy(&pixels[channel], data, length);
+    return;
+  }
+
+  // Device offset of each channel within a pixel, in R,G,B,W order
+  uint8_t offset[4] = {rOffset, gOffset, bOffset, wOffset};
+  uint8_t c = channel % bytesPerPixel;
+  uint8_t *p = &pixels[channel - c];
+  while (length--) {
+    uint8_t v = *data++;
+    p[offset[c]] = scaled ? (v * scale[c]) >> 8 : v;
+    if (++c >= bytesPerPixel) {
+      c = 0;
+      p += bytesPerPixel;
+    }
+  }
+}
+
 /*!
   @brief   Convert hue, saturation and value into a packed 32-bit RGB color
            that can be passed to setPixelColor() or other RGB-compatible
@@ -3596,9 +4050,11 @@ uint32_t Adafruit_NeoPixel::ColorHSV(uint16_t hue, uint8_t sat, uint8_t val) {
            (for RGBW pixels) or 0 (for RGB pixels), next is red, then green,
            and least significant byte is blue.
   @note    If the strip brightness has been changed from the default value
-           of 255, the color read from a pixel may not exactly match what
-           was previously written with one of the setPixelColor() functions.
-           This gets more pronounced at lower brightness levels.
+           of 255, or color correction is set, the color read from a pixel
+           may not exactly match what was previously written with one of
+           the setPixelColor() functions. This gets more pronounced at
+           lower brightness levels. White moved by setWhiteExtraction() is
+           not moved back.
 */
 uint32_t Adafruit_NeoPixel::getPixelColor(uint16_t n) const {
   if (n >= numLEDs)
@@ -3608,15 +4064,15 @@ uint32_t Adafruit_NeoPixel::getPixelColor(uint16_t n) const {
 
   if (wOffset == rOffset) { // Is RGB-type device
     p = &pixels[n * 3];
-    if (brightness) {
+    if (scaled) {
       // Stored color was decimated by setBrightness(). Returned value
       // attempts to scale back to an approximation of the original 24-bit
       // value used when setting the pixel color, but there will always be
       // some error -- those bits are simply gone. Issue is most
       // pronounced at low brightness levels.
-      return (((uint32_t)(p[rOffset] << 8) / brightness) << 16) |
-             (((uint32_t)(p[gOffset] << 8) / brightness) << 8) |
-             ((uint32_t)(p[bOffset] << 8) / brightness);
+      return (((uint32_t)(p[rOffset] << 8) / scale[0]) << 16) |
+             (((uint32_t)(p[gOffset] << 8) / scale[1]) << 8) |
+             ((uint32_t)(p[bOffset] << 8) / scale[2]);
     } else {
       // No brightness adjustment has been made -- return 'raw' color
       return ((uint32_t)p[rOffset] << 16) | ((uint32_t)p[gOffset] << 8) |
@@ -3624,11 +4080,11 @@ uint32_t Adafruit_NeoPixel::getPixelColor(uint16_t n) const {
     }
   } else { // Is RGBW-type device
     p = &pixels[n * 4];
-    if (brightness) { // Return scaled color
-      return (((uint32_t)(p[wOffset] << 8) / brightness) << 24) |
-             (((uint32_t)(p[rOffset] << 8) / brightness) << 16) |
-             (((uint32_t)(p[gOffset] << 8) / brightness) << 8) |
-             ((uint32_t)(p[bOffset] << 8) / brightness);
+    if (scaled) { // Return scaled color
+      return (((uint32_t)(p[wOffset] << 8) / scale[3]) << 24) |
+             (((uint32_t)(p[rOffset] << 8) / scale[0]) << 16) |
+             (((uint32_t)(p[gOffset] << 8) / scale[1]) << 8) |
+             ((uint32_t)(p[bOffset] << 8) / scale[2]);
     } else { // Return raw color
       return ((uint32_t)p[wOffset] << 24) | ((uint32_t)p[rOffset] << 16) |
              ((uint32_t)p[gOffset] << 8) | (uint32_t)p[bOffset];
@@ -3636,6 +4092,57 @@ uint32_t Adafruit_NeoPixel::getPixelColor(uint16_t n) const {
   }
 }
 
+/*!
+  @brief   Query the colors of a contiguous run of previously-set pixels.
+           Equivalent to calling getPixelColor() on each pixel in the
+           range, but much faster for read-modify-write effects over long
+           strips: the brightness de-scaling divides are done once per call
+           (as fixed-point reciprocals) rather than three or four times
+           per pixel, which matters a great deal on chips without a
+           hardware divider (AVR, Cortex-M0).
+  @param   first  Index of first pixel to read (0 = first).
+  @param   out    Destination array for 'packed' 32-bit RGB or WRGB values,
+                  in the same format returned by getPixelColor(). Must have
+                  room for 'count' elements.
+  @param   count  Number of pixels to read. Range is clipped to the end of
+                  the strip.
+  @return  Number of pixels actually written to 'out' (0 if first is out
+           of bounds).
+*/
+uint16_t Adafruit_NeoPixel::getPixels(uint16_t first, uint32_t *out,
+                                      uint16_t count) const {
+  if (first >= numLEDs)
+    return 0;
+  if (count > (numLEDs - first))
+    count = numLEDs - first;
+
+  uint8_t bpp = (wOffset == rOffset) ? 3 : 4;
+  const uint8_t *p = &pixels[first * bpp];
+
+  // (c << 8) / s == (c * recip) >> 16 for every 8-bit c and each
+  // element's scale s, given recip = ceil(2^24 / s). Largest product
+  // (255 * 2^24, at scale 1) still fits in 32 bits.
+  uint32_t recip[4];
+  if (scaled) {
+    for (uint8_t c = 0; c < 4; c++)
+      recip[c] = ((1UL << 24) + scale[c] - 1) / scale[c];
+  }
+
+  for (uint16_t i = 0; i < count; i++, p += bpp) {
+    uint32_t r = p[rOffset], g = p[gOffset], b = p[bOffset],
+             w = (bpp == 4) ? p[wOffset] : 0;
+    if (scaled) {
+      r = (r * recip[0]) >> 16;
+      g = (g * recip[1]) >> 16;
+      b = (b * recip[2]) >> 16;
+      w = (w * recip[3]) >> 16;
+    }
+    out[i] = (w << 24) | (r << 16) | (g << 8) | b;
+  }
+
+  return count;
+}
+
 /*!
   @brief   Adjust output brightness. Does not immediately affect what's
            currently displayed on the LEDs. The next call to show() will
@@ -3684,6 +4191,7 @@ void Adafruit_NeoPixel::setBrightness(uint8_t b) {
       *ptr++ = (c * scale) >> 8;
     }
     brightness = newBrightness;
+    updateScale();
   }
 }
 
@@ -3693,11 +4201,198 @@ void Adafruit_NeoPixel::setBrightness(uint8_t b) {
 */
 uint8_t Adafruit_NeoPixel::getBrightness(void) const { return brightness - 1; }
 
+/*!
+  @brief   Set per-element scale factors that even out the tint of a
+           strip (white balance), e.g. where its green and blue LEDs are
+           brighter than red, or to match batches of pixels that differ.
+           These are combined with brightness and any color temperature
+           into a single multiplier per element, applied where
+           setPixelColor() already scales for brightness, so they add no
+           work per pixel.
+  @param   r  Red scale, 0 (off) to 255 (unscaled).
+  @param   g  Green scale, 0 (off) to 255 (unscaled).
+  @param   b  Blue scale, 0 (off) to 255 (unscaled).
+  @param   w  White scale, 0 (off) to 255 (unscaled). Default is 255.
+  @note    Like setBrightness(), intended for one-time use in setup().
+           Unlike it, pixels already set are not re-scaled; only those
+           set after this call are corrected.
+*/
+void Adafruit_NeoPixel::setColorCorrection(uint8_t r, uint8_t g, uint8_t b,
+                                           uint8_t w) {
+  correction[0] = r;
+  correction[1] = g;
+  correction[2] = b;
+  correction[3] = w;
+  updateScale();
+}
+
+/*!
+  @brief   Set per-element scale factors for red, green and blue from a
+           packed value, e.g. one of the NEO_CORRECTION_* presets. White
+           is left unscaled.
+  @param   c  Packed 0xRRGGBB scale factors, each 0 (off) to 255
+              (unscaled). Most significant byte is ignored.
+*/
+void Adafruit_NeoPixel::setColorCorrection(uint32_t c) {
+  setColorCorrection((uint8_t)(c >> 16), (uint8_t)(c >> 8), (uint8_t)c,
+                     correction[3]);
+}
+
+/*!
+  @brief   Tint the strip toward the color of a light source, e.g. a warm
+           candle or tungsten glow, on top of any color correction. Like
+           setColorCorrection(), this is folded into the brightness
+           multiply and only affects pixels set after this call.
+  @param   c  Packed 0xRRGGBB scale factors, normally one of the NEO_TEMP_*
+              presets. NEO_TEMP_NONE removes the tint. The white element
+              is unaffected.
+*/
+void Adafruit_NeoPixel::setColorTemperature(uint32_t c) {
+  temperature = c & 0xFFFFFF;
+  updateScale();
+}
+
+/*!
+  @brief   Combine brightness, color correction and color temperature into
+           the per-element multipliers used by setPixelColor().
+*/
+void Adafruit_NeoPixel::updateScale(void) {
+  uint16_t b = brightness ? brightness : 256; // See notes in setBrightness()
+  uint8_t t[4] = {(uint8_t)(temperature >> 16), (uint8_t)(temperature >> 8),
+                  (uint8_t)temperature, 255};
+  uint16_t s[4];
+  scaled = false;
+  for (uint8_t c = 0; c < 4; c++) {
+    // Each factor is 1-256 (value + 1, as with brightness), multiplied
+    // through; 256 is unscaled
+    s[c] = ((uint32_t)(correction[c] + 1) * (t[c] + 1) * b) >> 16;
+    if (s[c] < 256)
+      scaled = true;
+  }
+  // Multipliers are 9 bits so an element left uncorrected (256) passes
+  // through unchanged even when others are scaled; with brightness alone
+  // they're the same values as before. Keep at least 1 so getPixelColor()
+  // needn't check before dividing.
+  for (uint8_t c = 0; c < 4; c++)
+    scale[c] = s[c] ? s[c] : 1;
+}
+
 /*!
   @brief   Fill the whole NeoPixel strip with 0 / black / off.
 */
 void Adafruit_NeoPixel::clear(void) { memset(pixels, 0, numBytes); }
 
+// The blending functions below operate directly on the device-order
+// 'pixels' buffer, since every channel is treated alike there's no need
+// to unpack colors. On 32-bit MCUs, four bytes are processed at a time
+// (SIMD-within-a-register): the even and odd bytes of a word are split
+// into two 0x00FF00FF-masked halves, leaving 8 bits of headroom per lane
+// so products up to 16 bits don't spill into the neighboring byte. The
+// 'pixels' buffer comes from malloc() and is thus suitably aligned for
+// word access; any remaining 1-3 bytes are handled one at a time. On AVR
+// this gains nothing, so only the bytewise loop is compiled there.
+
+/*!
+  @brief   Dim all pixels toward black by a fixed fraction. Handy for
+           trails, comets and other persistence effects.
+  @param   amount  Amount to fade, 0 = no change, 255 = nearly black
+                   (each channel is scaled by (256 - amount) / 256).
+  @note    Like setBrightness(), this is a lossy operation on the RAM
+           buffer; repeated fades will eventually reach zero.
+*/
+void Adafruit_NeoPixel::fadeBy(uint8_t amount) {
+  if (!amount)
+    return;
+  uint16_t scale = 256 - amount, i = 0;
+  uint8_t *ptr = pixels;
+#if !defined(__AVR__)
+  for (; (i + 4) <= numBytes; i += 4, ptr += 4) {
+    uint32_t x;
+    memcpy(&x, ptr, 4);
+    x = (((x & 0x00FF00FFUL) * scale >> 8) & 0x00FF00FFUL) |
+        ((((x >> 8) & 0x00FF00FFUL) * scale) & 0xFF00FF00UL);
+    memcpy(ptr, &x, 4);
+  }
+#endif
+  for (; i < numBytes; i++, ptr++)
+    *ptr = (*ptr * scale) >> 8;
+}
+
+/*!
+  @brief   Crossfade this strip's pixel data toward that of another strip,
+           e.g. an off-screen Adafruit_NeoPixel (with no pin) holding the
+           next scene.
+  @param   other  Strip to blend toward. Must use the same color order
+                  (NEO_* type) as this strip, else nothing is done. If the
+                  strips differ in length, only the overlapping pixels are
+                  blended.
+  @param   alpha  Blend amount, 0 = keep this strip's colors, 255 = take
+                  the other strip's colors.
+  @note    Both buffers are assumed to be at the same brightness setting.
+*/
+void Adafruit_NeoPixel::blend(const Adafruit_NeoPixel &other, uint8_t alpha) {
+  if ((other.rOffset != rOffset) || (other.gOffset != gOffset) ||
+      (other.bOffset != bOffset) || (other.wOffset != wOffset))
+    return;
+  uint16_t n = (other.numBytes < numBytes) ? other.numBytes : numBytes, i = 0;
+  // Weights a1 + a0 sum to 256 so the result fits the same lanes; 255
+  // is nudged to 256 so that alpha=255 reproduces 'other' exactly.
+  uint16_t a1 = alpha + (alpha >> 7), a0 = 256 - a1;
+  uint8_t *ptr = pixels;
+  const uint8_t *src = other.pixels;
+#if !defined(__AVR__)
+  for (; (i + 4) <= n; i += 4, ptr += 4, src += 4) {
+    uint32_t x, y;
+    memcpy(&x, ptr, 4);
+    memcpy(&y, src, 4);
+    uint32_t even = ((x & 0x00FF00FFUL) * a0 + (y & 0x00FF00FFUL) * a1) >> 8;
+    uint32_t odd = ((x >> 8) & 0x00FF00FFUL) * a0 +
+                   ((y >> 8) & 0x00FF00FFUL) * a1;
+    x = (even & 0x00FF00FFUL) | (odd & 0xFF00FF00UL);
+    memcpy(ptr, &x, 4);
+  }
+#endif
+  for (; i < n; i++, ptr++, src++)
+    *ptr = (*ptr * a0 + *src * a1) >> 8;
+}
+
+/*!
+  @brief   Add another strip's pixel data to this one, clipping each
+           channel at 255 rather than wrapping around. Useful for layering
+           sparkles or sprites (rendered to an off-screen strip) over a
+           background.
+  @param   other  Strip to add. Must use the same color order (NEO_* type)
+                  as this strip, else nothing is done. If the strips differ
+                  in length, only the overlapping pixels are added.
+*/
+void Adafruit_NeoPixel::addSaturate(const Adafruit_NeoPixel &other) {
+  if ((other.rOffset != rOffset) || (other.gOffset != gOffset) ||
+      (other.bOffset != bOffset) || (other.wOffset != wOffset))
+    return;
+  uint16_t n = (other.numBytes < numBytes) ? other.numBytes : numBytes, i = 0;
+  uint8_t *ptr = pixels;
+  const uint8_t *src = other.pixels;
+#if !defined(__AVR__)
+  for (; (i + 4) <= n; i += 4, ptr += 4, src += 4) {
+    uint32_t x, y;
+    memcpy(&x, ptr, 4);
+    memcpy(&y, src, 4);
+    // Add the low 7 bits of each lane (can't carry out of the lane), fix
+    // up bit 7, then work out which lanes carried out and force them to
+    // 0xFF (a 0x01 per lane times 255 never crosses a lane boundary).
+    uint32_t sum = ((x & 0x7F7F7F7FUL) + (y & 0x7F7F7F7FUL)) ^
+                   ((x ^ y) & 0x80808080UL);
+    uint32_t carry = ((x & y) | ((x | y) & ~sum)) & 0x80808080UL;
+    x = sum | ((carry >> 7) * 255);
+    memcpy(ptr, &x, 4);
+  }
+#endif
+  for (; i < n; i++, ptr++, src++) {
+    uint16_t c = *ptr + *src;
+    *ptr = (c > 255) ? 255 : c;
+  }
+}
+
 // A 32-bit variant of gamma8() that applies the same function
 // to all components of a packed RGB or WRGB value.
 uint32_t Adafruit_NeoPixel::gamma32(uint32_t x) {
@@ -3715,6 +4410,256 @@ uint32_t Adafruit_NeoPixel::gamma32(uint32_t x) {
   return x; // Packed 32-bit return
 }
 
+/*!
+  @brief   A 16-bit integer sine wave function, for smoother slow or
+           long-wavelength waves than sine8() allows. Values are linearly
+           interpolated from a quarter-wave table; error is within 3 of
+           the true value.
+  @param   x  Input angle, 0-65535; 65536 would loop back to zero,
+              completing the circle (equivalent to 360 degrees or 2 pi
+              radians). As with sine8(), an unsigned variable can simply
+              be allowed to overflow.
+  @return  Sine result, -32767 to +32767.
+*/
+int16_t Adafruit_NeoPixel::sin16(uint16_t x) {
+  // 256 steps of x per table segment. In the second and fourth quarters
+  // the table is read backward.
+  uint8_t seg = (x >> 8) & 63;
+  uint16_t f = x & 0xFF;
+  if (x & 0x4000) {
+    seg = 63 - seg;
+    f = 256 - f;
+  }
+  int16_t a = pgm_read_word(&_NeoPixelSine16Table[seg]),
+          b = pgm_read_word(&_NeoPixelSine16Table[seg + 1]);
+  int16_t v = a + (int16_t)(((uint32_t)(b - a) * f + 128) >> 8);
+  return (x & 0x8000) ? -v : v;
+}
+
+/*!
+  @brief   Fill a buffer with a sine wave, advancing the angle by a fixed
+           step per value (e.g. one value per pixel). Same results as
+           sin16() per value, but table entries are only read when the
+           angle moves into a new table segment, which for slow waves
+           is seldom.
+  @param   buf    Buffer to receive count values, -32767 to +32767.
+  @param   count  Number of values.
+  @param   x      Angle of first value, 0-65535 for one full cycle.
+  @param   dx     Angle step between values; wraps around as for sin16().
+*/
+void Adafruit_NeoPixel::fillSine16(int16_t *buf, uint16_t count, uint16_t x,
+                                   uint16_t dx) {
+  int16_t a = 0, d = 0; // Segment's start value and rise
+  uint16_t segment = 0xFFFF;
+  for (uint16_t i = 0; i < count; i++, x += dx) {
+    uint16_t f = x & 0xFF;
+    if ((x >> 8) != segment) {
+      segment = x >> 8;
+      uint8_t seg = segment & 63;
+      if (x & 0x4000)
+        seg = 63 - seg;
+      a = pgm_read_word(&_NeoPixelSine16Table[seg]);
+      d = (int16_t)pgm_read_word(&_NeoPixelSine16Table[seg + 1]) - a;
+    }
+    if (x & 0x4000)
+      f = 256 - f;
+    int16_t v = a + (int16_t)(((uint32_t)d * f + 128) >> 8);
+    buf[i] = (x & 0x8000) ? -v : v;
+  }
+}
+
+// Perlin noise, in fixed point. Lattice cell fractions are kept as 15-bit
+// values (0 to 32767, less 32768 for a cell's far side), gradients as
+// sums of those, and interpolation weights as 13 bits, so every product
+// fits in 32 bits. Results are then nominally -32768 to +32767.
+
+#define NOISE_HASH(i) pgm_read_byte(&_NeoPixelNoiseTable[(uint8_t)(i)])
+#define NOISE_ONE 32768 // Whole lattice cell in 15-bit fraction units
+
+// Dot product of one of Perlin's 12 gradient directions (selected by
+// hash) with the offset from a lattice corner
+static int32_t noiseGrad(uint8_t hash, int32_t x, int32_t y, int32_t z) {
+  uint8_t h = hash & 15;
+  int32_t u = (h < 8) ? x : y,
+          v = (h < 4) ? y : ((h == 12) || (h == 14)) ? x : z;
+  return ((h & 1) ? -u : u) + ((h & 2) ? -v : v);
+}
+
+// Perlin's quintic fade curve, 6t^5 - 15t^4 + 10t^3, for a 16-bit cell
+// fraction; returns a 13-bit interpolation weight
+static uint16_t noiseFade(uint16_t t) {
+  uint32_t t2 = ((uint32_t)t * t) >> 16, t3 = (t2 * t) >> 16;
+  uint32_t inner = 6 * t2 - 15 * (uint32_t)t + 10 * 65536; // 1 to 10 << 16
+  return (t3 * (inner >> 4)) >> 15;
+}
+
+static int32_t noiseLerp(int32_t a, int32_t b, uint16_t t) {
+  return a + (((b - a) * (int32_t)t) >> 13);
+}
+
+// Convert a nominally +/-32768 result to 0-65535
+static uint16_t noiseOut(int32_t n) {
+  n += 32768;
+  return (n < 0) ? 0 : (n > 65535) ? 65535 : n;
+}
+
+/*!
+  @brief   1D Perlin noise: a smoothly varying pseudorandom value, for
+           organic-looking animation (flicker, drifting color, etc.)
+           where sine8() would look too regular. Same input, same output.
+  @param   x  Position, 16.16 fixed point; the noise varies over roughly
+              one lattice cell (65536), and repeats every 256 cells.
+  @return  Noise value, 0-65535, centered on 32768.
+*/
+uint16_t Adafruit_NeoPixel::noise16(uint32_t x) {
+  uint8_t X = x >> 16;
+  int32_t fx = (x & 0xFFFF) >> 1;
+  // Gradients of several slopes, as ones of +/-1 give very regular bumps
+  uint8_t h0 = NOISE_HASH(X), h1 = NOISE_HASH(X + 1);
+  int32_t g0 = (fx * ((h0 & 7) + 1)) >> 2,
+          g1 = ((fx - NOISE_ONE) * ((h1 & 7) + 1)) >> 2;
+  return noiseOut(noiseLerp((h0 & 8) ? -g0 : g0, (h1 & 8) ? -g1 : g1,
+                            noiseFade(x)));
+}
+
+/*!
+  @brief   2D Perlin noise, e.g. for a matrix, or a strip (x) over time
+           (y). See the 1D noise16().
+  @param   x  X position, 16.16 fixed point (65536 = one lattice cell).
+  @param   y  Y position, 16.16 fixed point.
+  @return  Noise value, 0-65535, centered on 32768.
+*/
+uint16_t Adafruit_NeoPixel::noise16(uint32_t x, uint32_t y) {
+  uint8_t X = x >> 16, Y = y >> 16;
+  int32_t fx = (x & 0xFFFF) >> 1, fy = (y & 0xFFFF) >> 1;
+  uint16_t u = noiseFade(x), v = noiseFade(y);
+  uint8_t A = NOISE_HASH(X) + Y, B = NOISE_HASH(X + 1) + Y;
+  int32_t n = noiseLerp(
+      noiseLerp(noiseGrad(NOISE_HASH(A), fx, fy, 0),
+                noiseGrad(NOISE_HASH(B), fx - NOISE_ONE, fy, 0), u),
+      noiseLerp(noiseGrad(NOISE_HASH(A + 1), fx, fy - NOISE_ONE, 0),
+                noiseGrad(NOISE_HASH(B + 1), fx - NOISE_ONE, fy - NOISE_ONE,
+                          0),
+                u),
+      v);
+  return noiseOut(n);
+}
+
+/*!
+  @brief   3D Perlin noise, e.g. for a matrix (x, y) over time (z). See
+           the 1D noise16().
+  @param   x  X position, 16.16 fixed point (65536 = one lattice cell).
+  @param   y  Y position, 16.16 fixed point.
+  @param   z  Z position, 16.16 fixed point.
+  @return  Noise value, 0-65535, centered on 32768.
+*/
+uint16_t Adafruit_NeoPixel::noise16(uint32_t x, uint32_t y, uint32_t z) {
+  uint8_t X = x >> 16, Y = y >> 16, Z = z >> 16;
+  int32_t fx = (x & 0xFFFF) >> 1, fy = (y & 0xFFFF) >> 1,
+          fz = (z & 0xFFFF) >> 1;
+  int32_t fx1 = fx - NOISE_ONE, fy1 = fy - NOISE_ONE, fz1 = fz - NOISE_ONE;
+  uint16_t u = noiseFade(x), v = noiseFade(y), w = noiseFade(z);
+  uint8_t A = NOISE_HASH(X) + Y, AA = NOISE_HASH(A) + Z,
+          AB = NOISE_HASH(A + 1) + Z, B = NOISE_HASH(X + 1) + Y,
+          BA = NOISE_HASH(B) + Z, BB = NOISE_HASH(B + 1) + Z;
+  int32_t n = noiseLerp(
+      noiseLerp(noiseLerp(noiseGrad(NOISE_HASH(AA), fx, fy, fz),
+                          noiseGrad(NOISE_HASH(BA), fx1, fy, fz), u),
+                noiseLerp(noiseGrad(NOISE_HASH(AB), fx, fy1, fz),
+                          noiseGrad(NOISE_HASH(BB), fx1, fy1, fz), u),
+                v),
+      noiseLerp(noiseLerp(noiseGrad(NOISE_HASH(AA + 1), fx, fy, fz1),
+                          noiseGrad(NOISE_HASH(BA + 1), fx1, fy, fz1), u),
+                noiseLerp(noiseGrad(NOISE_HASH(AB + 1), fx, fy1, fz1),
+                          noiseGrad(NOISE_HASH(BB + 1), fx1, fy1, fz1), u),
+                v),
+      w);
+  return noiseOut(n);
+}
+
+/*!
+  @brief   Fill a buffer with 3D noise sampled at evenly spaced points
+           along X, e.g. one value per pixel of a strip or matrix row.
+           Much faster than calling noise16() per sample: each gradient
+           is linear in X, so the Y and Z interpolation is folded into two
+           straight lines once per lattice cell, leaving one fade and
+           interpolation per sample. Results may differ from noise16() by
+           a count or two of rounding.
+  @param   buf    Buffer to receive count values, 0-65535.
+  @param   count  Number of samples.
+  @param   x      X position of first sample, 16.16 fixed point.
+  @param   dx     X distance between samples, 16.16 fixed point.
+  @param   y      Y position, 16.16 fixed point. Default is 0.
+  @param   z      Z position (often time), 16.16 fixed point. Default is
+                  0.
+*/
+void Adafruit_NeoPixel::fillNoise16(uint16_t *buf, uint16_t count,
+                                    uint32_t x, uint32_t dx, uint32_t y,
+                                    uint32_t z) {
+  uint8_t Y = y >> 16, Z = z >> 16;
+  int32_t fy = (y & 0xFFFF) >> 1, fz = (z & 0xFFFF) >> 1;
+  int32_t fy1 = fy - NOISE_ONE, fz1 = fz - NOISE_ONE;
+  uint16_t v = noiseFade(y), w = noiseFade(z);
+  int32_t a0 = 0, a1 = 0, b0 = 0, b1 = 0; // Near, far lines: 0 + 1 * fx
+  uint16_t cell = 0;
+  bool first = true;
+
+  for (uint16_t i = 0; i < count; i++, x += dx) {
+    if (first || ((x >> 16) != cell)) {
+      first = false;
+      cell = x >> 16;
+      uint8_t X = cell, A = NOISE_HASH(X) + Y, B = NOISE_HASH(X + 1) + Y;
+      uint8_t h[8] = {NOISE_HASH(NOISE_HASH(A) + Z),
+                      NOISE_HASH(NOISE_HASH(A + 1) + Z),
+                      NOISE_HASH(NOISE_HASH(A) + Z + 1),
+                      NOISE_HASH(NOISE_HASH(A + 1) + Z + 1),
+                      NOISE_HASH(NOISE_HASH(B) + Z),
+                      NOISE_HASH(NOISE_HASH(B + 1) + Z),
+                      NOISE_HASH(NOISE_HASH(B) + Z + 1),
+                      NOISE_HASH(NOISE_HASH(B + 1) + Z + 1)};
+      // Constant (Y, Z) part and X slope (13-bit fixed point) of each
+      // corner's gradient, interpolated across Y and Z
+      int32_t k[8], s[8];
+      for (uint8_t c = 0; c < 8; c++) {
+        k[c] = noiseGrad(h[c], 0, (c & 1) ? fy1 : fy, (c & 2) ? fz1 : fz);
+        s[c] = noiseGrad(h[c], 8192, 0, 0);
+      }
+      a0 = noiseLerp(noiseLerp(k[0], k[1], v), noiseLerp(k[2], k[3], v), w);
+      a1 = noiseLerp(noiseLerp(s[0], s[1], v), noiseLerp(s[2], s[3], v), w);
+      b0 = noiseLerp(noiseLerp(k[4], k[5], v), noiseLerp(k[6], k[7], v), w);
+      b1 = noiseLerp(noiseLerp(s[4], s[5], v), noiseLerp(s[6], s[7], v), w);
+    }
+    int32_t fx = (x & 0xFFFF) >> 1;
+    int32_t na = a0 + ((a1 * fx) >> 13),
+            nb = b0 + ((b1 * (fx - NOISE_ONE)) >> 13);
+    buf[i] = noiseOut(noiseLerp(na, nb, noiseFade(x)));
+  }
+}
+
+/*!
+  @brief   Fill a buffer with 3D noise, 8-bit version. See fillNoise16().
+  @param   buf    Buffer to receive count values, 0-255.
+  @param   count  Number of samples.
+  @param   x      X position of first sample, 8.8 fixed point.
+  @param   dx     X distance between samples, 8.8 fixed point.
+  @param   y      Y position, 8.8 fixed point. Default is 0.
+  @param   z      Z position (often time), 8.8 fixed point. Default is 0.
+*/
+void Adafruit_NeoPixel::fillNoise8(uint8_t *buf, uint16_t count, uint16_t x,
+                                   uint16_t dx, uint16_t y, uint16_t z) {
+  // Convert in chunks through a small buffer
+  uint16_t chunk[16];
+  uint32_t xx = (uint32_t)x << 8, dxx = (uint32_t)dx << 8;
+  while (count) {
+    uint8_t n = (count > 16) ? 16 : count;
+    fillNoise16(chunk, n, xx, dxx, (uint32_t)y << 8, (uint32_t)z << 8);
+    for (uint8_t i = 0; i < n; i++)
+      *buf++ = chunk[i] >> 8;
+    xx += dxx * n;
+    count -= n;
+  }
+}
+
 /*!
   @brief   Fill NeoPixel strip with one or more cycles of hues.
            Everyone loves the rainbow swirl so much, now it's canon!
@@ -133,6 +133,18 @@
 #define NEO_KHZ400 0x0100 ///< 400 KHz data transmission
 #endif
 
+// Add NEO_KHZFAST instead to 'overclock' the data stream to about 1 MHz
+// (bit timing is 4/5 that of the chip, see setChip()), which many WS2812B
+// and SK6812 batches accept, for proportionally shorter frames on long
+// strips. Not all pixels tolerate this, test before relying on it! This
+// only has effect on architectures with adjustable bit timing (ESP32,
+// ESP8266, K210, nRF52, RP2040, see neoPixelTiming); elsewhere it's the
+// same as NEO_KHZ800. Requires the 16-bit type, as does NEO_KHZ400.
+
+#ifdef NEO_KHZ400
+#define NEO_KHZFAST 0x0200 ///< ~1 MHz (overclocked) data transmission
+#endif
+
 // If 400 KHz support is enabled, the third parameter to the constructor
 // requires a 16-bit value (in order to select 400 vs 800 KHz speed).
 // If only 800 KHz is enabled (as is default on ATtiny), an 8-bit value
@@ -144,6 +156,103 @@ typedef uint16_t neoPixelType; ///< 3rd arg to Adafruit_NeoPixel constructor
 typedef uint8_t neoPixelType; ///< 3rd arg to Adafruit_NeoPixel constructor
 #endif
 
+// Per-channel scale factors for setColorCorrection(), packed as 0xRRGGBB
+// (255 = unscaled). Green and blue elements of most RGB LEDs are brighter
+// than red at the same value, giving white a blue-green cast; these trim
+// them back. Strip batches vary, so measure your own if it matters.
+#define NEO_CORRECTION_NONE 0xFFFFFF  ///< No correction
+#define NEO_CORRECTION_5050 0xFFB0F0  ///< Typical 5050 SMD LED strip
+#define NEO_CORRECTION_8MM 0xFFE08C   ///< Typical 8mm through-hole pixel
+
+// Color temperature presets for setColorTemperature(), packed as 0xRRGGBB,
+// approximating the named light source's tint.
+#define NEO_TEMP_NONE 0xFFFFFF           ///< No tint (the default)
+#define NEO_TEMP_CANDLE 0xFF9329         ///< Candle, 1900 K
+#define NEO_TEMP_TUNGSTEN_40W 0xFFC58F   ///< 40 W tungsten bulb, 2600 K
+#define NEO_TEMP_TUNGSTEN_100W 0xFFD6AA  ///< 100 W tungsten bulb, 2850 K
+#define NEO_TEMP_HALOGEN 0xFFF1E0        ///< Halogen lamp, 3200 K
+#define NEO_TEMP_CARBON_ARC 0xFFFAF4     ///< Carbon arc lamp, 5200 K
+#define NEO_TEMP_HIGH_NOON_SUN 0xFFFFFB  ///< High noon sun, 5400 K
+#define NEO_TEMP_DIRECT_SUNLIGHT 0xFFFFFF ///< Direct sunlight, 6000 K
+#define NEO_TEMP_OVERCAST_SKY 0xC9E2FF   ///< Overcast sky, 7000 K
+#define NEO_TEMP_CLEAR_BLUE_SKY 0x409CFF ///< Clear blue sky, 20000 K
+
+// Uncomment the following line to have show() keep timing statistics
+// (see getStats()), for profiling how a sketch's frame time is spent.
+// It's off by default since it adds a few micros() calls to each show()
+// and about 40 bytes of RAM to each Adafruit_NeoPixel object.
+//#define NEO_SHOW_STATS
+
+#if defined(NEO_SHOW_STATS)
+/*!
+    @brief  Timing statistics accumulated by show() when NEO_SHOW_STATS
+            is defined. All times are in microseconds.
+*/
+typedef struct {
+  uint32_t shows;         ///< Number of frames transmitted
+  uint32_t latchWait;     ///< Total time spent waiting for latch
+  uint32_t latchWaitMax;  ///< Longest single latch wait
+  uint32_t transmit;      ///< Total time spent transmitting data
+  uint32_t transmitMax;   ///< Longest single transmission
+  uint32_t irqOff;        ///< Total time with interrupts disabled
+  uint32_t irqOffMax;     ///< Longest single interrupts-disabled interval
+  uint32_t frameInterval; ///< Average time between show() calls
+  uint32_t lastShow;      ///< micros() at start of most recent show()
+} neoPixelStats;
+#endif
+
+/*!
+    @brief  A snapshot of the pixel data, pre-encoded where possible into
+            the bitstream the output peripheral consumes (PWM pattern on
+            nRF52, RMT symbols on ESP32 with ESP-IDF 5), made by
+            encodeFrame() and issued with showEncoded(). Elsewhere only the
+            pixel data is kept and showEncoded() is equivalent to show().
+            Zero-initialize before first use (neoPixelFrame frame = {};)
+            and release with Adafruit_NeoPixel::freeFrame().
+*/
+typedef struct {
+  uint8_t *pixels;      ///< Copy of the pixel data that was encoded
+  void *encoded;        ///< Backend-native bitstream, or NULL if none
+  uint32_t encodedSize; ///< Size of encoded bitstream in bytes
+  uint16_t numBytes;    ///< Size of pixel data in bytes
+} neoPixelFrame;
+
+/*!
+    @brief  NeoPixel-compatible driver chips with known characteristics,
+            passed to setChip(). This doesn't alter color order (still
+            given by the NEO_* type constants), only per-chip details: the
+            bit timing (on architectures where it's adjustable, see
+            neoPixelTiming) and the data latch (reset) interval.
+*/
+typedef enum {
+  NEO_CHIP_WS2812B, ///< WS2812B V5 and later (the default), 300 uS latch
+  NEO_CHIP_WS2812,  ///< Original WS2812 and early WS2812B, 50 uS latch
+  NEO_CHIP_SK6812,  ///< SK6812 and SK6812RGBW, 80 uS latch
+  NEO_CHIP_WS2811,  ///< WS2811, 280 uS latch
+  NEO_CHIP_WS2815,  ///< WS2813 and WS2815, 280 uS latch
+  NEO_CHIP_TM1814,  ///< TM1814, 200 uS latch
+  NEO_CHIP_COUNT    ///< Number of chip types (not a valid setting)
+} neoPixelChip;
+
+/*!
+    @brief  Bitstream timing for a NeoPixel-compatible chip, as selected by
+            setChip() or given directly to setTiming(). Bit timing is used
+            by the ESP32, ESP8266, K210, nRF52 and RP2040 code, where it's
+            derived at run time from a clock. The cycle-counted code for
+            other architectures (AVR, SAMD, etc.) has fixed, hand-tuned
+            timing and uses only the latch time. On the RP2040, only the
+            bit period is adjustable (the high times keep the proportions
+            of the PIO program). Data sent with NEO_KHZ400 always uses the
+            classic 400 KHz WS2811 timing; with NEO_KHZFAST, all bit times
+            here are scaled by 4/5.
+*/
+typedef struct {
+  uint16_t t0h;    ///< High time of a '0' bit, nanoseconds
+  uint16_t t1h;    ///< High time of a '1' bit, nanoseconds
+  uint16_t period; ///< Total time of one bit, nanoseconds
+  uint16_t latch;  ///< Data latch (reset) interval, microseconds
+} neoPixelTiming;
+
 // These two tables are declared outside the Adafruit_NeoPixel class
 // because some boards may require oldschool compilers that don't
 // handle the C++11 constexpr keyword.
@@ -175,6 +284,24 @@ static const uint8_t PROGMEM _NeoPixelSineTable[256] = {
     79,  82,  85,  88,  90,  93,  97,  100, 103, 106, 109, 112, 115, 118, 121,
     124};
 
+/* A quarter sine wave, 16-bit signed, in 64 steps plus the endpoint, for
+   sin16(); other quarters are mirrored from this and values between
+   steps are interpolated.
+   Copy & paste this snippet into a Python REPL to regenerate:
+import math
+for x in range(65):
+    print("{:5},".format(int(math.sin(x/64.0*math.pi/2)*32767+0.5))),
+    if x%10 == 9: print
+*/
+static const int16_t PROGMEM _NeoPixelSine16Table[65] = {
+    0,     804,   1608,  2410,  3212,  4011,  4808,  5602,  6393,  7179,
+    7962,  8739,  9512,  10278, 11039, 11793, 12539, 13279, 14010, 14732,
+    15446, 16151, 16846, 17530, 18204, 18868, 19519, 20159, 20787, 21403,
+    22005, 22594, 23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+    27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956, 30273, 30571,
+    30852, 31113, 31356, 31580, 31785, 31971, 32137, 32285, 32412, 32521,
+    32609, 32678, 32728, 32757, 32767};
+
 /* Similar to above, but for an 8-bit gamma-correction table.
    Copy & paste this snippet into a Python REPL to regenerate:
 import math
@@ -203,6 +330,31 @@ static const uint8_t PROGMEM _NeoPixelGammaTable[256] = {
     218, 220, 223, 225, 227, 230, 232, 235, 237, 240, 242, 245, 247, 250, 252,
     255};
 
+/* A PROGMEM (flash mem) table holding a permutation of 0-255, used to hash
+   lattice coordinates in the noise functions. These are the values from
+   Ken Perlin's reference implementation of improved noise, so results
+   match other ports of it.
+*/
+static const uint8_t PROGMEM _NeoPixelNoiseTable[256] = {
+    151, 160, 137, 91,  90,  15,  131, 13,  201, 95,  96,  53,  194, 233, 7,
+    225, 140, 36,  103, 30,  69,  142, 8,   99,  37,  240, 21,  10,  23,  190,
+    6,   148, 247, 120, 234, 75,  0,   26,  197, 62,  94,  252, 219, 203, 117,
+    35,  11,  32,  57,  177, 33,  88,  237, 149, 56,  87,  174, 20,  125, 136,
+    171, 168, 68,  175, 74,  165, 71,  134, 139, 48,  27,  166, 77,  146, 158,
+    231, 83,  111, 229, 122, 60,  211, 133, 230, 220, 105, 92,  41,  55,  46,
+    245, 40,  244, 102, 143, 54,  65,  25,  63,  161, 1,   216, 80,  73,  209,
+    76,  132, 187, 208, 89,  18,  169, 200, 196, 135, 130, 116, 188, 159, 86,
+    164, 100, 109, 198, 173, 186, 3,   64,  52,  217, 226, 250, 124, 123, 5,
+    202, 38,  147, 118, 126, 255, 82,  85,  212, 207, 206, 59,  227, 47,  16,
+    58,  17,  182, 189, 28,  42,  223, 183, 170, 213, 119, 248, 152, 2,   44,
+    154, 163, 70,  221, 153, 101, 155, 167, 43,  172, 9,   129, 22,  39,  253,
+    19,  98,  108, 110, 79,  113, 224, 232, 178, 185, 112, 104, 218, 246, 97,
+    228, 251, 34,  242, 193, 238, 210, 144, 12,  191, 179, 162, 241, 81,  51,
+    145, 235, 249, 14,  239, 107, 49,  192, 214, 31,  181, 199, 106, 157, 184,
+    84,  204, 176, 115, 121, 50,  45,  127, 4,   150, 254, 138, 236, 205, 93,
+    222, 114, 67,  29,  24,  72,  243, 141, 128, 195, 78,  66,  215, 61,  156,
+    180};
+
 /* Declare external methods required by the Adafruit_NeoPixel implementation
     for specific hardware/library versions
 */
@@ -227,29 +379,105 @@ public:
 
   bool begin(void);
   void show(void);
+  bool tryShow(void);
+  bool encodeFrame(neoPixelFrame &frame);
+  bool updateFrame(neoPixelFrame &frame, uint16_t first, uint16_t count);
+  /*!
+    @brief   Re-encode a frame from encodeFrame() to match the current
+             pixel data, from a given pixel to the end of the strip.
+    @param   frame  Frame from encodeFrame(), for this strip.
+    @param   first  Index of first pixel to re-encode. Default is 0, the
+                    whole strip.
+    @return  true on success, false if frame is empty or the strip length
+             has changed since it was encoded.
+  */
+  bool updateFrame(neoPixelFrame &frame, uint16_t first = 0) {
+    return updateFrame(frame, first, numLEDs);
+  }
+  void showEncoded(const neoPixelFrame &frame);
+  static void freeFrame(neoPixelFrame &frame);
   void setPin(int16_t p);
   void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b);
   void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b, uint8_t w);
   void setPixelColor(uint16_t n, uint32_t c);
   void fill(uint32_t c = 0, uint16_t first = 0, uint16_t count = 0);
+  void setChannels(uint32_t channel, const uint8_t *data, uint32_t length);
   void setBrightness(uint8_t);
+  void setColorCorrection(uint8_t r, uint8_t g, uint8_t b, uint8_t w = 255);
+  void setColorCorrection(uint32_t c);
+  void setColorTemperature(uint32_t c);
+  /*!
+    @brief   On RGBW strips, move the white shared by R, G and B (their
+             minimum) onto the W element when pixels are set, e.g. so
+             white drawn as RGB uses the dedicated white LED. Has no
+             effect on RGB strips, or on raw channel data (setChannels(),
+             image blits and the like). Only affects pixels set after
+             this call.
+    @param   on  true to extract white, false (the default) to store
+                 colors as given.
+  */
+  void setWhiteExtraction(bool on) { extractWhite = on; }
   void clear(void);
+  void fadeBy(uint8_t amount);
+  void blend(const Adafruit_NeoPixel &other, uint8_t alpha);
+  void addSaturate(const Adafruit_NeoPixel &other);
   void updateLength(uint16_t n);
   void updateType(neoPixelType t);
+  void setChip(neoPixelChip chip);
+  /*!
+    @brief   Set custom bitstream timing, e.g. to run chips that tolerate
+             it at tighter timing than their datasheet for shorter frames.
+             See neoPixelTiming for which architectures honor this.
+    @param   t  Bit timing (nanoseconds) and latch time (microseconds).
+    @note    On RP2040, call this (or setChip()) before begin().
+  */
+  void setTiming(const neoPixelTiming &t) { timing = t; }
+  /*!
+    @brief   Retrieve the bitstream timing set by setChip() or
+             setTiming().
+    @return  Reference to the strip's neoPixelTiming.
+  */
+  const neoPixelTiming &getTiming(void) const { return timing; }
+  /*!
+    @brief   Set the data latch (reset) interval that show() must leave
+             between frames, overriding the default or setChip() value.
+             Chips that latch sooner than the WS2812B's 300 microseconds
+             can thus be refreshed at a higher frame rate.
+    @param   us  Latch time in microseconds.
+  */
+  void setLatchTime(uint16_t us) { timing.latch = us; }
+  /*!
+    @brief   Retrieve the data latch (reset) interval used by show().
+    @return  Latch time in microseconds.
+  */
+  uint16_t getLatchTime(void) const { return timing.latch; }
+  bool setMaxCurrent(uint16_t mA);
+  void setCurrentModel(uint8_t r, uint8_t g, uint8_t b, uint8_t w = 20,
+                       uint8_t idle = 1);
+  uint32_t estimateCurrent(void) const;
   /*!
     @brief   Check whether a call to show() will start sending data
              immediately or will 'block' for a required interval. NeoPixels
-             require a short quiet time (about 300 microseconds) after the
-             last bit is received before the data 'latches' and new data can
-             start being received. Usually one's sketch is implicitly using
-             this time to generate a new frame of animation...but if it
-             finishes very quickly, this function could be used to see if
-             there's some idle time available for some low-priority
-             concurrent task.
+             require a short quiet time (about 300 microseconds for most,
+             see setLatchTime()) after the last bit is received before the
+             data 'latches' and new data can start being received.
+             Usually one's sketch is implicitly using this time to generate
+             a new frame of animation...but if it finishes very quickly,
+             this function could be used to see if there's some idle time
+             available for some low-priority concurrent task.
     @return  1 or true if show() will start sending immediately, 0 or false
              if show() would block (meaning some idle time is available).
   */
-  bool canShow(void) {
+  bool canShow(void) { return !latchRemaining(); }
+  /*!
+    @brief   Report how long a call to show() would 'block' waiting for the
+             data latch interval (see canShow()). Cooperative main loops can
+             use this to decide whether some other task fits in the gap,
+             rather than spinning inside show().
+    @return  Microseconds remaining until show() can start sending, or 0
+             if it can start immediately.
+  */
+  uint32_t latchRemaining(void) {
     // It's normal and possible for endTime to exceed micros() if the
     // 32-bit clock counter has rolled over (about every 70 minutes).
     // Since both are uint32_t, a negative delta correctly maps back to
@@ -259,7 +487,7 @@ public:
     // that interval, the delta calculation is no longer correct and the
     // next update may stall for a very long time. The check below resets
     // the latch counter if a rollover has occurred. This can cause an
-    // extra delay of up to 300 microseconds in the rare case where a
+    // extra delay of up to the latch time in the rare case where a
     // show() call happens precisely around the rollover, but that's
     // neither likely nor especially harmful, vs. other code that might
     // stall for 30+ minutes, or having to document and frequently remind
@@ -269,7 +497,8 @@ public:
     if (endTime > now) {
       endTime = now;
     }
-    return (now - endTime) >= 300L;
+    uint32_t elapsed = now - endTime;
+    return (elapsed >= timing.latch) ? 0 : (timing.latch - elapsed);
   }
   /*!
     @brief   Get a pointer directly to the NeoPixel data buffer in RAM.
@@ -286,6 +515,20 @@ public:
              responsibility and all that.
   */
   uint8_t *getPixels(void) const { return pixels; };
+  /*!
+    @brief   Exchange the strip's pixel buffer for another of the same
+             size, e.g. to fill one buffer while the other is shown.
+    @param   buf  Buffer of numChannels() bytes, from malloc(). The strip
+                  takes it over, freeing it if the strip is resized or
+                  destroyed.
+    @return  Previous pixel buffer, now the caller's to free.
+  */
+  uint8_t *swapPixels(uint8_t *buf) {
+    uint8_t *old = pixels;
+    pixels = buf;
+    return old;
+  }
+  uint16_t getPixels(uint16_t first, uint32_t *out, uint16_t count) const;
   uint8_t getBrightness(void) const;
   /*!
     @brief   Retrieve the pin number used for NeoPixel data output.
@@ -297,6 +540,78 @@ public:
     @return  Pixel count (0 if not set).
   */
   uint16_t numPixels(void) const { return numLEDs; }
+  /*!
+    @brief   Return the number of color channels (bytes) in the strip, for
+             use with setChannels().
+    @return  Channel count, 3 or 4 per pixel (0 if not set).
+  */
+  uint16_t numChannels(void) const { return numBytes; }
+  /*!
+    @brief   Return the number of bytes each pixel takes in the
+             getPixels() buffer.
+    @return  3 for RGB strips, 4 for RGBW.
+  */
+  uint8_t bytesPerPixel(void) const { return (wOffset == rOffset) ? 3 : 4; }
+  /*!
+    @brief   Return the strip's color order, i.e. where each element of a
+             pixel is stored in the getPixels() buffer.
+    @return  NEO_* color order value as passed to the constructor (e.g.
+             NEO_GRB), without the NEO_KHZ* bits: the white byte's index
+             is in bits 7-6 (equal to red's if the strip has no white),
+             red's in bits 5-4, green's in 3-2 and blue's in 1-0.
+  */
+  uint8_t getOrder(void) const {
+    return (wOffset << 6) | (rOffset << 4) | (gOffset << 2) | bOffset;
+  }
+  /*!
+    @brief   Retrieve the per-element multipliers setPixelColor() applies
+             for brightness and color correction, for code writing to the
+             getPixels() buffer directly. Each stored value is the color
+             element times its multiplier, shifted right 8 bits.
+    @return  Pointer to R,G,B,W multipliers, 1-256 (256 leaves an element
+             unchanged), or NULL if colors are currently stored unscaled.
+  */
+  const uint16_t *getScale(void) const { return scaled ? scale : NULL; }
+  /*!
+    @brief   Apply brightness and color correction to a color's elements,
+             as setPixelColor() stores them on RGB strips.
+    @param   r  Red element, scaled in place.
+    @param   g  Green element, scaled in place.
+    @param   b  Blue element, scaled in place.
+  */
+  void scaleColor(uint8_t &r, uint8_t &g, uint8_t &b) const {
+    if (scaled) { // See notes in setBrightness()
+      r = (r * scale[0]) >> 8;
+      g = (g * scale[1]) >> 8;
+      b = (b * scale[2]) >> 8;
+    }
+  }
+  /*!
+    @brief   Apply white extraction (RGBW strips only), then brightness and
+             color correction, to a color's elements, as setPixelColor()
+             stores them.
+    @param   r  Red element, scaled in place.
+    @param   g  Green element, scaled in place.
+    @param   b  Blue element, scaled in place.
+    @param   w  White element, scaled in place (0 if none).
+  */
+  void scaleColor(uint8_t &r, uint8_t &g, uint8_t &b, uint8_t &w) const {
+    if (extractWhite && (wOffset != rOffset)) { // See setWhiteExtraction()
+      uint8_t m = (r < g) ? r : g;
+      if (b < m)
+        m = b;
+      r -= m;
+      g -= m;
+      b -= m;
+      w = ((w + m) > 255) ? 255 : (w + m);
+    }
+    if (scaled) { // See notes in setBrightness()
+      r = (r * scale[0]) >> 8;
+      g = (g * scale[1]) >> 8;
+      b = (b * scale[2]) >> 8;
+      w = (w * scale[3]) >> 8;
+    }
+  }
   uint32_t getPixelColor(uint16_t n) const;
   /*!
     @brief   An 8-bit integer sine wave function, not directly compatible
@@ -327,6 +642,47 @@ public:
   static uint8_t gamma8(uint8_t x) {
     return pgm_read_byte(&_NeoPixelGammaTable[x]); // 0-255 in, 0-255 out
   }
+  static int16_t sin16(uint16_t x);
+  /*!
+    @brief   A 16-bit integer cosine wave function. See sin16().
+    @param   x  Input angle, 0-65535 for one full cycle.
+    @return  Cosine result, -32767 to +32767.
+  */
+  static int16_t cos16(uint16_t x) { return sin16(x + 16384); }
+  static void fillSine16(int16_t *buf, uint16_t count, uint16_t x,
+                         uint16_t dx);
+  static uint16_t noise16(uint32_t x);
+  static uint16_t noise16(uint32_t x, uint32_t y);
+  static uint16_t noise16(uint32_t x, uint32_t y, uint32_t z);
+  /*!
+    @brief   1D Perlin noise, 8-bit version. See noise16().
+    @param   x  Position, 8.8 fixed point (256 = one lattice cell).
+    @return  Noise value, 0-255, centered on 128.
+  */
+  static uint8_t noise8(uint16_t x) { return noise16((uint32_t)x << 8) >> 8; }
+  /*!
+    @brief   2D Perlin noise, 8-bit version. See noise16().
+    @param   x  X position, 8.8 fixed point (256 = one lattice cell).
+    @param   y  Y position, 8.8 fixed point.
+    @return  Noise value, 0-255, centered on 128.
+  */
+  static uint8_t noise8(uint16_t x, uint16_t y) {
+    return noise16((uint32_t)x << 8, (uint32_t)y << 8) >> 8;
+  }
+  /*!
+    @brief   3D Perlin noise, 8-bit version. See noise16().
+    @param   x  X position, 8.8 fixed point (256 = one lattice cell).
+    @param   y  Y position, 8.8 fixed point.
+    @param   z  Z position (often time), 8.8 fixed point.
+    @return  Noise value, 0-255, centered on 128.
+  */
+  static uint8_t noise8(uint16_t x, uint16_t y, uint16_t z) {
+    return noise16((uint32_t)x << 8, (uint32_t)y << 8, (uint32_t)z << 8) >> 8;
+  }
+  static void fillNoise16(uint16_t *buf, uint16_t count, uint32_t x,
+                          uint32_t dx, uint32_t y = 0, uint32_t z = 0);
+  static void fillNoise8(uint8_t *buf, uint16_t count, uint16_t x,
+                         uint16_t dx, uint16_t y = 0, uint16_t z = 0);
   /*!
     @brief   Convert separate red, green and blue values into a single
              "packed" 32-bit RGB color.
@@ -376,8 +732,24 @@ public:
                bool gammify = true);
 
   static neoPixelType str2order(const char *v);
+#if defined(NEO_SHOW_STATS)
+  /*!
+    @brief   Retrieve timing statistics accumulated by show(). Only
+             available if NEO_SHOW_STATS is defined in Adafruit_NeoPixel.h.
+    @return  Reference to the strip's neoPixelStats structure.
+  */
+  const neoPixelStats &getStats(void) const { return stats; }
+  void resetStats(void);
+  uint16_t getFPS(void) const;
+#endif
 
 private:
+  uint8_t *limitCurrent(void);
+  neoPixelTiming bitTiming(void) const;
+  void updateScale(void);
+#if defined(NEO_SHOW_STATS)
+  void updateStats(uint32_t start, uint32_t latched);
+#endif
 #if defined(ARDUINO_ARCH_RP2040)
   bool   rp2040claimPIO(void);
   void   rp2040releasePIO(void);
@@ -390,6 +762,7 @@ private:
 protected:
 #ifdef NEO_KHZ400 // If 400 KHz NeoPixel support enabled...
   bool is800KHz; ///< true if 800 KHz pixels
+  bool isFast;   ///< true if overclocked (NEO_KHZFAST) pixels
 #endif
 
   bool begun;         ///< true if begin() previously called successfully
@@ -397,12 +770,25 @@ protected:
   uint16_t numBytes;  ///< Size of 'pixels' buffer below
   int16_t pin;        ///< Output pin number (-1 if not yet set)
   uint8_t brightness; ///< Strip brightness 0-255 (stored as +1)
+  uint16_t scale[4];  ///< R,G,B,W brightness * correction, 1-256 (/256)
+  bool scaled;        ///< true if scale[] applies (else unscaled)
+  bool extractWhite;  ///< true if setWhiteExtraction() is on
+  uint8_t correction[4]; ///< R,G,B,W setColorCorrection() factors
+  uint32_t temperature;  ///< setColorTemperature() tint, 0xRRGGBB
   uint8_t *pixels;    ///< Holds LED color values (3 or 4 bytes each)
   uint8_t rOffset;    ///< Red index within each 3- or 4-byte pixel
   uint8_t gOffset;    ///< Index of green byte
   uint8_t bOffset;    ///< Index of blue byte
   uint8_t wOffset;    ///< Index of white (==rOffset if no white)
   uint32_t endTime;   ///< Latch timing reference
+  neoPixelTiming timing; ///< Bit timing and latch interval
+  uint16_t maxCurrent;   ///< Power budget in mA for show() (0 = no limit)
+  uint8_t *limitBuf;     ///< Dimmed copy of pixels for current limiting
+  uint8_t channelmA[4];  ///< Full-on current of R,G,B,W elements, in mA
+  uint8_t idlemA;        ///< Quiescent current per pixel, in mA
+#if defined(NEO_SHOW_STATS)
+  neoPixelStats stats;   ///< show() timing statistics
+#endif
 
 #ifdef __AVR__
   volatile uint8_t *port; ///< Output PORT register
@@ -0,0 +1,190 @@
+/*!
+ * @file Adafruit_NeoPixel_Adalight.cpp
+ *
+ * @section intro_sec Introduction
+ *
+ * Adalight serial streaming receiver for the Adafruit_NeoPixel library.
+ *
+ * @section license License
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "Adafruit_NeoPixel_Adalight.h"
+
+/*!
+  @brief   Adalight receiver constructor.
+  @param   strip   Adafruit_NeoPixel object, already begun. Must outlive
+                   the receiver.
+  @param   serial  Serial port (or other Stream) frames arrive on, already
+                   begun at the host software's baud rate.
+*/
+Adafruit_NeoPixel_Adalight::Adafruit_NeoPixel_Adalight(
+    Adafruit_NeoPixel &strip, Stream &serial)
+    : strip(strip), serial(serial), back(NULL), frames(0), lastRead(0),
+      remaining(0), received(0), backSize(0), headerLength(0) {}
+
+/*!
+  @brief   Deallocate Adalight receiver.
+*/
+Adafruit_NeoPixel_Adalight::~Adafruit_NeoPixel_Adalight() { free(back); }
+
+/*!
+  @brief   Announce the receiver to the host software (which waits for
+           "Ada\n" before streaming) and allocate the second buffer, if
+           used.
+  @param   doubleBuffer  true (the default) to receive into a second
+                         buffer, false to receive straight into the
+                         strip's pixels, saving RAM.
+  @return  true on success, false if there's insufficient RAM for double
+           buffering (the receiver then works single-buffered).
+*/
+bool Adafruit_NeoPixel_Adalight::begin(bool doubleBuffer) {
+  free(back);
+  back = NULL;
+  backSize = 0;
+  if (doubleBuffer && strip.numChannels()) {
+    if (!(back = (uint8_t *)malloc(strip.numChannels())))
+      return false;
+    backSize = strip.numChannels();
+  }
+  remaining = 0;
+  headerLength = 0;
+  serial.print("Ada\n");
+  return true;
+}
+
+/*!
+  @brief   Call frequently from loop(). Reads whatever serial data is
+           available, and when a frame is complete, shows it.
+  @return  true if a new frame was shown.
+*/
+bool Adafruit_NeoPixel_Adalight::update(void) {
+  if (remaining && ((millis() - lastRead) > NEO_ADALIGHT_TIMEOUT)) {
+    remaining = 0; // Host went quiet mid-frame, look for a new header
+    headerLength = 0;
+  }
+
+  int avail;
+  while ((avail = serial.available()) > 0) {
+    if (!remaining) {
+      // Look for 'A','d','a',count high,count low,checksum
+      uint8_t c = serial.read();
+      if ((headerLength < 3) && (c != "Ada"[headerLength])) {
+        headerLength = (c == 'A') ? 1 : 0;
+        continue;
+      }
+      header[headerLength++] = c;
+      if (headerLength < sizeof header)
+        continue;
+      headerLength = 0;
+      if ((header[3] ^ header[4] ^ 0x55) != header[5])
+        continue; // Bad checksum, keep looking
+
+      remaining = (((uint32_t)header[3] << 8 | header[4]) + 1) * 3;
+      received = 0;
+      lastRead = millis();
+      uint16_t numBytes = strip.numChannels();
+      if (back && (backSize != numBytes)) {
+        // Strip length changed since begin()
+        free(back);
+        backSize = (back = (uint8_t *)malloc(numBytes)) ? numBytes : 0;
+      }
+      if (back && (remaining < ((uint32_t)strip.numPixels() * 3))) {
+        // Frame is shorter than strip; carry over the remaining pixels
+        // so they don't flip between old frames each swap
+        uint32_t offset = (remaining / 3) * strip.bytesPerPixel();
+        memcpy(back + offset, strip.getPixels() + offset, backSize - offset);
+      }
+      continue;
+    }
+
+    uint8_t *buf = back ? back : strip.getPixels();
+    uint32_t n = ((uint32_t)avail < remaining) ? avail : remaining;
+    uint32_t capacity = (uint32_t)strip.numPixels() * 3; // Bytes strip uses
+    if ((strip.bytesPerPixel() == 3) && (received < capacity)) {
+      // RGB strip: stream bytes map 1:1 onto the buffer, read in place
+      if (n > (capacity - received))
+        n = capacity - received;
+      n = serial.readBytes(buf + received, n);
+      store(buf, received, n);
+    } else {
+      // RGBW strip (3 stream bytes per 4 buffer bytes), or data past end
+      // of strip: go through a small chunk
+      uint8_t chunk[48];
+      if (n > sizeof chunk)
+        n = sizeof chunk;
+      n = serial.readBytes(chunk, n);
+      const uint16_t *s = strip.getScale();
+      uint8_t order = strip.getOrder();
+      // Byte offset of each stream element (R,G,B), then of white
+      uint8_t offset[4] = {(uint8_t)((order >> 4) & 3),
+                           (uint8_t)((order >> 2) & 3), (uint8_t)(order & 3),
+                           (uint8_t)(order >> 6)};
+      for (uint32_t i = 0; i < n; i++) {
+        uint32_t pos = received + i;
+        if (pos >= capacity)
+          break;
+        uint8_t *p = &buf[(pos / 3) * 4], c = pos % 3;
+        p[offset[c]] = s ? (chunk[i] * s[c]) >> 8 : chunk[i];
+        if (!c)
+          p[offset[3]] = 0;
+      }
+    }
+    if (!n)
+      break;
+    received += n;
+    remaining -= n;
+    lastRead = millis();
+
+    if (!remaining) {
+      if (back)
+        back = strip.swapPixels(back);
+      strip.show();
+      frames++;
+      return true;
+    }
+  }
+  return false;
+}
+
+/*!
+  @brief   Reorder and scale, in place, any RGB strip pixels completed by
+           the latest read.
+  @param   buf    Buffer being received into.
+  @param   first  Stream offset of first byte read.
+  @param   count  Number of bytes read.
+*/
+void Adafruit_NeoPixel_Adalight::store(uint8_t *buf, uint32_t first,
+                                       uint32_t count) {
+  const uint16_t *s = strip.getScale();
+  uint8_t order = strip.getOrder(), rOffset = (order >> 4) & 3,
+          gOffset = (order >> 2) & 3, bOffset = order & 3;
+  if (!s && !rOffset && (gOffset == 1))
+    return; // NEO_RGB at full brightness, already in place
+  for (uint32_t i = first / 3; i < (first + count) / 3; i++) {
+    uint8_t *p = &buf[i * 3], r = p[0], g = p[1], bl = p[2];
+    if (s) { // See notes in setBrightness()
+      r = (r * s[0]) >> 8;
+      g = (g * s[1]) >> 8;
+      bl = (bl * s[2]) >> 8;
+    }
+    p[rOffset] = r;
+    p[gOffset] = g;
+    p[bOffset] = bl;
+  }
+}
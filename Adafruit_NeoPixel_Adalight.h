@@ -0,0 +1,78 @@
+/*!
+ * @file Adafruit_NeoPixel_Adalight.h
+ *
+ * Adalight serial streaming receiver for the Adafruit_NeoPixel library,
+ * compatible with host software such as Prismatik, Hyperion and
+ * HyperHDR.
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADAFRUIT_NEOPIXEL_ADALIGHT_H
+#define ADAFRUIT_NEOPIXEL_ADALIGHT_H
+
+#include "Adafruit_NeoPixel.h"
+
+#define NEO_ADALIGHT_TIMEOUT 250 ///< ms of silence that abandons a frame
+
+/*!
+    @brief  Class that receives Adalight frames from a serial port (or
+            any Stream) into an Adafruit_NeoPixel strip. Each frame is
+            'A','d','a', the LED count minus 1 (16 bits, high byte
+            first), a checksum (the two count bytes XORed with 0x55), then
+            R,G,B for each LED.
+
+            Payload is read in bulk straight into the pixel buffer;
+            strips in NEO_RGB order with no brightness or color correction
+            set need no further processing, others are reordered and
+            scaled in place as each pixel arrives. With double buffering
+            (the default), frames are received into a second buffer that's
+            swapped with the strip's once complete, so the strip's pixels
+            always hold a whole frame and the next frame's bytes can be
+            accepted as soon as show() returns.
+*/
+class Adafruit_NeoPixel_Adalight {
+
+public:
+  Adafruit_NeoPixel_Adalight(Adafruit_NeoPixel &strip, Stream &serial);
+  ~Adafruit_NeoPixel_Adalight();
+
+  bool begin(bool doubleBuffer = true);
+  bool update(void);
+  /*!
+    @brief   Query the number of complete frames received and shown.
+    @return  Frame count.
+  */
+  uint32_t getFrameCount(void) const { return frames; }
+
+private:
+  void store(uint8_t *buf, uint32_t first, uint32_t count);
+
+  Adafruit_NeoPixel &strip; ///< Strip receiving frames
+  Stream &serial;           ///< Source of frames
+  uint8_t *back;            ///< Receive buffer, NULL if single-buffered
+  uint32_t frames;          ///< Complete frames received
+  uint32_t lastRead;        ///< millis() of last data byte
+  uint32_t remaining;       ///< Payload bytes left in current frame
+  uint32_t received;        ///< Payload bytes received in current frame
+  uint16_t backSize;        ///< Size of back in bytes
+  uint8_t header[6];        ///< Header bytes received so far
+  uint8_t headerLength;     ///< Number of valid bytes in header
+};
+
+#endif // ADAFRUIT_NEOPIXEL_ADALIGHT_H
@@ -0,0 +1,186 @@
+/*!
+ * @file Adafruit_NeoPixel_ArtNet.cpp
+ *
+ * @section intro_sec Introduction
+ *
+ * Art-Net receiver for the Adafruit_NeoPixel library. Handles ArtDmx and
+ * ArtSync from Art-Net 4 (Art-Net is a trademark of Artistic Licence).
+ *
+ * @section license License
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "Adafruit_NeoPixel_ArtNet.h"
+
+// Byte offsets of packet fields. OpCode is little-endian, others
+// big-endian.
+#define ARTNET_OPCODE 8
+#define ARTNET_VERSION 10
+#define ARTNET_DMX_SUBUNI 14
+#define ARTNET_DMX_NET 15
+#define ARTNET_DMX_LENGTH 16
+#define ARTNET_DMX_DATA 18
+#define ARTNET_SYNC_SIZE 14
+
+#define ARTNET_OP_DMX 0x5000
+#define ARTNET_OP_SYNC 0x5200
+
+#define ARTNET_SYNC_TIMEOUT 4000 // ms without ArtSync before reverting
+
+/*!
+  @brief   Art-Net receiver constructor. Add strips with addOutput().
+*/
+Adafruit_NeoPixel_ArtNet::Adafruit_NeoPixel_ArtNet(void)
+    : packets(0), frames(0), lastSync(0), channelsPerUniverse(510),
+      numOutputs(0), synced(false), autoShow(true) {}
+
+/*!
+  @brief   Assign a strip to receive data, starting at a given universe
+           and DMX address and continuing through as many consecutive
+           universes as the strip needs (up to NEO_ARTNET_MAX_UNIVERSES).
+  @param   strip     Adafruit_NeoPixel object, already begun. Must outlive
+                     the receiver.
+  @param   universe  First universe, as a 15-bit Port-Address (Net,
+                     Sub-Net and Universe combined), 0-32767.
+  @param   address   DMX address (1-512) of the first pixel's red channel
+                     within that universe. Default is 1.
+  @return  true on success, false if the receiver already has
+           NEO_ARTNET_MAX_OUTPUTS strips, the arguments are out of
+           range or the strip would span more than
+           NEO_ARTNET_MAX_UNIVERSES universes.
+*/
+bool Adafruit_NeoPixel_ArtNet::addOutput(Adafruit_NeoPixel &strip,
+                                         uint16_t universe,
+                                         uint16_t address) {
+  if ((numOutputs >= NEO_ARTNET_MAX_OUTPUTS) || (universe > 0x7FFF) ||
+      !address || (address > 512))
+    return false;
+  Output &o = outputs[numOutputs];
+  o.strip = &strip;
+  o.universe = universe;
+  o.address = address;
+  o.received = 0;
+  // Each universe takes one bit of the received mask
+  if (universes(numOutputs) > NEO_ARTNET_MAX_UNIVERSES)
+    return false;
+  numOutputs++;
+  return true;
+}
+
+/*!
+  @brief   Process one received UDP payload, writing any pixel data it
+           carries into the strips and showing those that are complete
+           (or all pending, on ArtSync).
+  @param   packet  Payload of a UDP packet received on NEO_ARTNET_PORT.
+  @param   length  Payload size in bytes.
+  @return  true if the packet was a valid ArtDmx or ArtSync packet and
+           was accepted, false otherwise (malformed, or other OpCodes
+           such as ArtPoll, which this receiver doesn't answer).
+*/
+bool Adafruit_NeoPixel_ArtNet::handlePacket(const uint8_t *packet,
+                                            uint16_t length) {
+  if ((length < ARTNET_SYNC_SIZE) || memcmp(packet, "Art-Net", 8) ||
+      (packet[ARTNET_VERSION] != 0) || (packet[ARTNET_VERSION + 1] < 14))
+    return false;
+  uint16_t opcode = packet[ARTNET_OPCODE] | (packet[ARTNET_OPCODE + 1] << 8);
+
+  if (opcode == ARTNET_OP_SYNC) {
+    synced = true;
+    lastSync = millis();
+    packets++;
+    if (autoShow)
+      show();
+    return true;
+  }
+
+  if ((opcode != ARTNET_OP_DMX) || (length < ARTNET_DMX_DATA))
+    return false;
+  uint16_t slots = (packet[ARTNET_DMX_LENGTH] << 8) |
+                   packet[ARTNET_DMX_LENGTH + 1];
+  if (!slots || (slots > 512) || ((ARTNET_DMX_DATA + slots) > length))
+    return false;
+  uint16_t universe = ((packet[ARTNET_DMX_NET] & 0x7F) << 8) |
+                      packet[ARTNET_DMX_SUBUNI];
+  const uint8_t *data = &packet[ARTNET_DMX_DATA];
+  if (slots > channelsPerUniverse)
+    slots = channelsPerUniverse;
+
+  if (synced && ((millis() - lastSync) > ARTNET_SYNC_TIMEOUT))
+    synced = false; // Console stopped sending ArtSync
+
+  for (uint8_t i = 0; i < numOutputs; i++) {
+    Output &o = outputs[i];
+    if (universe < o.universe)
+      continue;
+    // Strip channel corresponding to this universe's first slot; negative
+    // if the strip begins partway into it
+    int32_t channel = (int32_t)(universe - o.universe) * channelsPerUniverse -
+                      (o.address - 1);
+    uint16_t skip = 0;
+    if (channel < 0) {
+      skip = -channel;
+      channel = 0;
+    }
+    if ((skip >= slots) || (channel >= o.strip->numChannels()))
+      continue;
+    o.strip->setChannels(channel, data + skip, slots - skip);
+    if ((universe - o.universe) < NEO_ARTNET_MAX_UNIVERSES)
+      o.received |= 1UL << (universe - o.universe);
+
+    if (autoShow && !synced) {
+      // Show once every universe of the strip is in
+      uint16_t n = universes(i);
+      uint32_t all = (n >= 32) ? 0xFFFFFFFF : ((1UL << n) - 1);
+      if (o.received == all) {
+        o.strip->show();
+        o.received = 0;
+        frames++;
+      }
+    }
+  }
+
+  packets++;
+  return true;
+}
+
+/*!
+  @brief   Call show() on each strip written since its last show().
+           Only needed if setAutoShow(false) was used.
+*/
+void Adafruit_NeoPixel_ArtNet::show(void) {
+  for (uint8_t i = 0; i < numOutputs; i++) {
+    if (outputs[i].received) {
+      outputs[i].strip->show();
+      outputs[i].received = 0;
+      frames++;
+    }
+  }
+}
+
+/*!
+  @brief   Number of universes spanned by a strip.
+  @param   i  Index into outputs.
+  @return  Universe count.
+*/
+uint16_t Adafruit_NeoPixel_ArtNet::universes(uint8_t i) const {
+  const Output &o = outputs[i];
+  uint32_t channels = o.strip->numChannels();
+  if (!channels)
+    return 0;
+  return (o.address - 1 + channels - 1) / channelsPerUniverse + 1;
+}
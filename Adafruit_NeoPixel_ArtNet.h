@@ -0,0 +1,139 @@
+/*!
+ * @file Adafruit_NeoPixel_ArtNet.h
+ *
+ * Art-Net receiver for the Adafruit_NeoPixel library, mapping DMX
+ * universes onto one or more strips.
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADAFRUIT_NEOPIXEL_ARTNET_H
+#define ADAFRUIT_NEOPIXEL_ARTNET_H
+
+#include "Adafruit_NeoPixel.h"
+
+#ifndef NEO_ARTNET_MAX_OUTPUTS
+#define NEO_ARTNET_MAX_OUTPUTS 4 ///< Max strips per receiver
+#endif
+
+#define NEO_ARTNET_PORT 6454        ///< Standard Art-Net UDP port
+#define NEO_ARTNET_MAX_PACKET 530   ///< Largest ArtDmx packet in bytes
+#define NEO_ARTNET_MAX_UNIVERSES 32 ///< Max universes spanned by one strip
+
+/*!
+    @brief  Class that decodes Art-Net ArtDmx and ArtSync packets into
+            Adafruit_NeoPixel strips. It doesn't depend on any particular
+            network stack: pass each received UDP payload to
+            handlePacket(), or call read() with any Arduino UDP object
+            bound to NEO_ARTNET_PORT.
+
+            Each strip takes its channels, in R,G,B(,W) order, from
+            consecutive universes (15-bit Port-Addresses) starting at a
+            given universe and DMX address. Universes hold 510 channels by
+            default, so RGB pixels don't straddle universes; see
+            setChannelsPerUniverse(). One strip may span at most
+            NEO_ARTNET_MAX_UNIVERSES (32) universes, e.g. 5440 RGB pixels;
+            split longer runs across several strips or receivers.
+
+            To avoid tearing, a strip is shown only once every universe
+            it spans has arrived since its last show(). If the console
+            sends ArtSync, strips are instead shown when ArtSync arrives,
+            until none has been received for 4 seconds (as the Art-Net
+            specification requires).
+
+            read() receives into a NEO_ARTNET_MAX_PACKET (530 byte)
+            buffer kept in the object rather than on the stack, so the
+            receiver takes about 600 bytes of RAM; declare it globally,
+            not as a local variable.
+*/
+class Adafruit_NeoPixel_ArtNet {
+
+public:
+  Adafruit_NeoPixel_ArtNet(void);
+
+  bool addOutput(Adafruit_NeoPixel &strip, uint16_t universe,
+                 uint16_t address = 1);
+  bool handlePacket(const uint8_t *packet, uint16_t length);
+  void show(void);
+  /*!
+    @brief   Receive and handle one packet, if available, from an Arduino
+             UDP object.
+    @param   udp  Any object with Arduino's UDP parsePacket() and read()
+                  methods, already begun on NEO_ARTNET_PORT.
+    @return  true if a packet was received and accepted.
+  */
+  template <class UDP> bool read(UDP &udp) {
+    if (udp.parsePacket() <= 0)
+      return false;
+    int length = udp.read(rxBuffer, sizeof rxBuffer);
+    return (length > 0) && handlePacket(rxBuffer, length);
+  }
+  /*!
+    @brief   Set the number of channels used in each universe. Strips
+             continue into the next universe after this many. Call before
+             addOutput(), which checks each strip's universe count.
+    @param   n  Channels per universe, 1-512. Default is 510 (170 RGB
+                pixels); RGBW setups commonly use 512 (128 pixels).
+  */
+  void setChannelsPerUniverse(uint16_t n) {
+    channelsPerUniverse = ((n >= 1) && (n <= 512)) ? n : 510;
+  }
+  /*!
+    @brief   Set whether the receiver calls show() on strips itself, as
+             described above.
+    @param   on  true (the default) to show automatically, false if the
+                 sketch will call show() itself.
+  */
+  void setAutoShow(bool on) { autoShow = on; }
+  /*!
+    @brief   Query the number of packets accepted.
+    @return  Packet count.
+  */
+  uint32_t getPacketCount(void) const { return packets; }
+  /*!
+    @brief   Query the number of times strips have been shown, for
+             comparing against getPacketCount().
+    @return  Frame count.
+  */
+  uint32_t getFrameCount(void) const { return frames; }
+
+private:
+  uint16_t universes(uint8_t i) const;
+
+  /*!
+    @brief  A strip, where its channels begin and which universes have
+            arrived for the current frame.
+  */
+  struct Output {
+    Adafruit_NeoPixel *strip; ///< Strip receiving data
+    uint16_t universe;        ///< First universe
+    uint16_t address;         ///< DMX address (1-512) of first channel
+    uint32_t received;        ///< Bitmask of universes since last show()
+  } outputs[NEO_ARTNET_MAX_OUTPUTS]; ///< Strips receiving data
+
+  uint32_t packets;             ///< Packets accepted
+  uint32_t frames;              ///< Frames shown
+  uint32_t lastSync;            ///< millis() at last ArtSync
+  uint16_t channelsPerUniverse; ///< Channels used in each universe
+  uint8_t numOutputs;           ///< Number of entries in outputs
+  bool synced;                  ///< true if ArtSync seen recently
+  bool autoShow;                ///< true if showing strips automatically
+  uint8_t rxBuffer[NEO_ARTNET_MAX_PACKET]; ///< Packet received by read()
+};
+
+#endif // ADAFRUIT_NEOPIXEL_ARTNET_H
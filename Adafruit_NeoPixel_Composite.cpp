@@ -0,0 +1,193 @@
+/*!
+ * @file Adafruit_NeoPixel_Composite.cpp
+ *
+ * @section intro_sec Introduction
+ *
+ * Multi-output composite strip for the Adafruit_NeoPixel library.
+ *
+ * @section license License
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "Adafruit_NeoPixel_Composite.h"
+
+/*!
+  @brief   Composite constructor. Add strips with addOutput().
+*/
+Adafruit_NeoPixel_Composite::Adafruit_NeoPixel_Composite(void)
+    : numLEDs(0), numOutputs(0), last(0) {}
+
+/*!
+  @brief   Append a strip to the composite.
+  @param   strip  Adafruit_NeoPixel object, already begun with its final
+                  length. Must outlive the composite. Its first pixel
+                  follows the last pixel of the previously added strip.
+  @return  true on success, false if the composite already has
+           NEO_COMPOSITE_MAX_OUTPUTS strips or would exceed 65535 pixels.
+*/
+bool Adafruit_NeoPixel_Composite::addOutput(Adafruit_NeoPixel &strip) {
+  if ((numOutputs >= NEO_COMPOSITE_MAX_OUTPUTS) ||
+      ((uint32_t)numLEDs + strip.numPixels() > 0xFFFF))
+    return false;
+  outputs[numOutputs] = &strip;
+  start[numOutputs++] = numLEDs;
+  numLEDs += strip.numPixels();
+  return true;
+}
+
+/*!
+  @brief   Find the strip holding a composite pixel.
+  @param   n  Pixel index, less than numLEDs.
+  @return  Index into outputs.
+*/
+uint8_t Adafruit_NeoPixel_Composite::locate(uint16_t n) const {
+  uint8_t i = last;
+  if ((n < start[i]) || (n - start[i] >= outputs[i]->numPixels())) {
+    for (i = numOutputs - 1; start[i] > n; i--)
+      ;
+    last = i;
+  }
+  return i;
+}
+
+/*!
+  @brief   Transmit all strips' pixel data. Strips are shown one after
+           another; rather than waiting out one strip's data latch
+           interval while others are ready, strips whose latch has
+           elapsed go first, so latch times overlap other strips' data.
+*/
+void Adafruit_NeoPixel_Composite::show(void) {
+  if (!numOutputs)
+    return;
+  uint32_t pending = 0xFFFFFFFFUL >> (32 - numOutputs); // One bit per strip
+  while (pending) {
+    for (uint8_t i = 0; i < numOutputs; i++) {
+      if ((pending & (1UL << i)) && outputs[i]->tryShow())
+        pending &= ~(1UL << i);
+    }
+  }
+}
+
+/*!
+  @brief   Check whether a call to show() will start sending data to every
+           strip immediately. See the strip's canShow().
+  @return  true if no strip's show() would block.
+*/
+bool Adafruit_NeoPixel_Composite::canShow(void) {
+  for (uint8_t i = 0; i < numOutputs; i++) {
+    if (!outputs[i]->canShow())
+      return false;
+  }
+  return true;
+}
+
+/*!
+  @brief   Set a pixel's color using separate red, green and blue
+           components.
+  @param   n  Pixel index, starting from 0 (first pixel of first strip).
+  @param   r  Red brightness, 0 = minimum (off), 255 = maximum.
+  @param   g  Green brightness, 0 = minimum (off), 255 = maximum.
+  @param   b  Blue brightness, 0 = minimum (off), 255 = maximum.
+*/
+void Adafruit_NeoPixel_Composite::setPixelColor(uint16_t n, uint8_t r,
+                                                uint8_t g, uint8_t b) {
+  if (n < numLEDs) {
+    uint8_t i = locate(n);
+    outputs[i]->setPixelColor(n - start[i], r, g, b);
+  }
+}
+
+/*!
+  @brief   Set a pixel's color using separate red, green, blue and white
+           components (for RGBW strips).
+  @param   n  Pixel index, starting from 0 (first pixel of first strip).
+  @param   r  Red brightness, 0 = minimum (off), 255 = maximum.
+  @param   g  Green brightness, 0 = minimum (off), 255 = maximum.
+  @param   b  Blue brightness, 0 = minimum (off), 255 = maximum.
+  @param   w  White brightness, 0 = minimum (off), 255 = maximum, ignored
+              on RGB strips.
+*/
+void Adafruit_NeoPixel_Composite::setPixelColor(uint16_t n, uint8_t r,
+                                                uint8_t g, uint8_t b,
+                                                uint8_t w) {
+  if (n < numLEDs) {
+    uint8_t i = locate(n);
+    outputs[i]->setPixelColor(n - start[i], r, g, b, w);
+  }
+}
+
+/*!
+  @brief   Set a pixel's color using a 32-bit 'packed' RGB or RGBW value.
+  @param   n  Pixel index, starting from 0 (first pixel of first strip).
+  @param   c  32-bit color value, as from Adafruit_NeoPixel::Color().
+*/
+void Adafruit_NeoPixel_Composite::setPixelColor(uint16_t n, uint32_t c) {
+  if (n < numLEDs) {
+    uint8_t i = locate(n);
+    outputs[i]->setPixelColor(n - start[i], c);
+  }
+}
+
+/*!
+  @brief   Fill all or part of the composite with a color, a strip's
+           worth at a time.
+  @param   c      32-bit color value. If unspecified or 0, pixels are
+                  filled with 0 / black / off.
+  @param   first  Index of first pixel to fill, starting from 0. If
+                  unspecified, filling begins at the first pixel.
+  @param   count  Number of pixels to fill, as a positive value. Passing 0
+                  or leaving unspecified will fill to end of composite.
+*/
+void Adafruit_NeoPixel_Composite::fill(uint32_t c, uint16_t first,
+                                       uint16_t count) {
+  if (first >= numLEDs)
+    return;
+  uint16_t end = (!count || (count > (numLEDs - first))) ? numLEDs
+                                                         : first + count;
+  for (uint8_t i = locate(first); (i < numOutputs) && (start[i] < end); i++) {
+    uint16_t from = (first > start[i]) ? first - start[i] : 0,
+             to = end - start[i];
+    if (to > outputs[i]->numPixels())
+      to = outputs[i]->numPixels();
+    if (to > from)
+      outputs[i]->fill(c, from, to - from);
+  }
+}
+
+/*!
+  @brief   Set the brightness of every strip. See the strip's
+           setBrightness().
+  @param   b  Brightness setting, 0=minimum (off), 255=brightest.
+*/
+void Adafruit_NeoPixel_Composite::setBrightness(uint8_t b) {
+  for (uint8_t i = 0; i < numOutputs; i++)
+    outputs[i]->setBrightness(b);
+}
+
+/*!
+  @brief   Query the color of a previously-set pixel.
+  @param   n  Pixel index, starting from 0 (first pixel of first strip).
+  @return  Pixel color as the owning strip's getPixelColor() returns it,
+           or 0 if n is out of range.
+*/
+uint32_t Adafruit_NeoPixel_Composite::getPixelColor(uint16_t n) const {
+  if (n >= numLEDs)
+    return 0;
+  uint8_t i = locate(n);
+  return outputs[i]->getPixelColor(n - start[i]);
+}
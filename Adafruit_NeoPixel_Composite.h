@@ -0,0 +1,83 @@
+/*!
+ * @file Adafruit_NeoPixel_Composite.h
+ *
+ * One logical NeoPixel strip made of several physical strips on separate
+ * pins.
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADAFRUIT_NEOPIXEL_COMPOSITE_H
+#define ADAFRUIT_NEOPIXEL_COMPOSITE_H
+
+#include "Adafruit_NeoPixel.h"
+
+#ifndef NEO_COMPOSITE_MAX_OUTPUTS
+#define NEO_COMPOSITE_MAX_OUTPUTS 8 ///< Max strips per composite (up to 32)
+#endif
+#if NEO_COMPOSITE_MAX_OUTPUTS > 32
+#error "NEO_COMPOSITE_MAX_OUTPUTS must be 32 or less"
+#endif
+
+/*!
+    @brief  Class that joins several Adafruit_NeoPixel strips, usually on
+            separate pins, end to end into one logical strip with the
+            same drawing functions. Splitting a long run of pixels across
+            several shorter chains cuts the time each chain's show() takes,
+            so the whole display refreshes faster than one chain could.
+
+            Pixel indices are routed to strips by comparing against each
+            strip's starting index (no division), checking the strip used
+            by the previous call first, so sequential drawing rarely
+            searches at all.
+*/
+class Adafruit_NeoPixel_Composite {
+
+public:
+  Adafruit_NeoPixel_Composite(void);
+
+  bool addOutput(Adafruit_NeoPixel &strip);
+  void show(void);
+  bool canShow(void);
+  void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b);
+  void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b, uint8_t w);
+  void setPixelColor(uint16_t n, uint32_t c);
+  void fill(uint32_t c = 0, uint16_t first = 0, uint16_t count = 0);
+  void setBrightness(uint8_t b);
+  uint32_t getPixelColor(uint16_t n) const;
+  /*!
+    @brief   Fill the whole composite with 0 / black / off.
+  */
+  void clear(void) { fill(0); }
+  /*!
+    @brief   Return the total number of pixels in all strips.
+    @return  Pixel count.
+  */
+  uint16_t numPixels(void) const { return numLEDs; }
+
+private:
+  uint8_t locate(uint16_t n) const;
+
+  Adafruit_NeoPixel *outputs[NEO_COMPOSITE_MAX_OUTPUTS]; ///< Strips, in order
+  uint16_t start[NEO_COMPOSITE_MAX_OUTPUTS]; ///< First index of each strip
+  uint16_t numLEDs;                          ///< Total pixels
+  uint8_t numOutputs;                        ///< Number of entries in outputs
+  mutable uint8_t last;                      ///< Output of most recent pixel
+};
+
+#endif // ADAFRUIT_NEOPIXEL_COMPOSITE_H
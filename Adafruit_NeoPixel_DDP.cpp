@@ -0,0 +1,143 @@
+/*!
+ * @file Adafruit_NeoPixel_DDP.cpp
+ *
+ * @section intro_sec Introduction
+ *
+ * DDP (Distributed Display Protocol, http://www.3waylabs.com/ddp/)
+ * receiver for the Adafruit_NeoPixel library.
+ *
+ * @section license License
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "Adafruit_NeoPixel_DDP.h"
+
+// Header fields, multi-byte values big-endian
+#define DDP_FLAGS 0
+#define DDP_TYPE 2
+#define DDP_ID 3
+#define DDP_OFFSET 4
+#define DDP_LENGTH 8
+#define DDP_HEADER_SIZE 10 // 14 if DDP_FLAG_TIME set
+
+#define DDP_FLAG_VERSION_MASK 0xC0
+#define DDP_FLAG_VERSION_1 0x40
+#define DDP_FLAG_TIME 0x10  // Timecode follows header
+#define DDP_FLAG_STORE 0x08 // Storage (not display) data
+#define DDP_FLAG_REPLY 0x04 // Reply to a query
+#define DDP_FLAG_QUERY 0x02 // Request for status, config, etc.
+#define DDP_FLAG_PUSH 0x01  // Display data received so far
+
+#define DDP_TYPE_CUSTOM 0x80 // Type field is application-defined
+
+#define DDP_ID_DISPLAY 1 // Default output device
+#define DDP_ID_ALL 255   // All devices
+
+/*!
+  @brief   DDP receiver constructor. Add strips with addOutput().
+*/
+Adafruit_NeoPixel_DDP::Adafruit_NeoPixel_DDP(void)
+    : changed(0), packets(0), frameStart(0), packetLatency(0),
+      frameLatency(0), numOutputs(0), autoShow(true) {}
+
+/*!
+  @brief   Append a strip to the display.
+  @param   strip  Adafruit_NeoPixel object, already begun. Must outlive
+                  the receiver. Its first channel follows the last channel
+                  of the previously added strip.
+  @return  true on success, false if the receiver already has
+           NEO_DDP_MAX_OUTPUTS strips.
+*/
+bool Adafruit_NeoPixel_DDP::addOutput(Adafruit_NeoPixel &strip) {
+  if (numOutputs >= NEO_DDP_MAX_OUTPUTS)
+    return false;
+  outputs[numOutputs++] = &strip;
+  return true;
+}
+
+/*!
+  @brief   Process one received UDP payload, writing any pixel data it
+           carries into the strips and, if it has the PUSH flag and
+           auto-show is on, showing them.
+  @param   packet  Payload of a UDP packet received on NEO_DDP_PORT.
+  @param   length  Payload size in bytes.
+  @return  true if the packet was valid DDP display data (or a bare PUSH)
+           for this device and was accepted, false otherwise (malformed,
+           queries, storage, other destinations, custom data types).
+*/
+bool Adafruit_NeoPixel_DDP::handlePacket(const uint8_t *packet,
+                                         uint16_t length) {
+  uint32_t start = micros();
+  if (length < DDP_HEADER_SIZE)
+    return false;
+  uint8_t flags = packet[DDP_FLAGS];
+  uint8_t header = (flags & DDP_FLAG_TIME) ? 14 : DDP_HEADER_SIZE;
+  if (((flags & DDP_FLAG_VERSION_MASK) != DDP_FLAG_VERSION_1) ||
+      (flags & (DDP_FLAG_STORE | DDP_FLAG_REPLY | DDP_FLAG_QUERY)) ||
+      (packet[DDP_TYPE] & DDP_TYPE_CUSTOM) ||
+      ((packet[DDP_ID] != DDP_ID_DISPLAY) && (packet[DDP_ID] != DDP_ID_ALL)))
+    return false;
+  uint32_t offset = ((uint32_t)packet[DDP_OFFSET] << 24) |
+                    ((uint32_t)packet[DDP_OFFSET + 1] << 16) |
+                    ((uint32_t)packet[DDP_OFFSET + 2] << 8) |
+                    packet[DDP_OFFSET + 3];
+  uint16_t dataLength = (packet[DDP_LENGTH] << 8) | packet[DDP_LENGTH + 1];
+  if ((header + dataLength) > length)
+    return false;
+  const uint8_t *data = &packet[header];
+
+  if (!changed)
+    frameStart = start; // First packet of a new frame
+
+  // Walk the strips, each covering the next numChannels() of the display
+  uint32_t base = 0;
+  for (uint8_t i = 0; (i < numOutputs) && dataLength; i++) {
+    uint32_t channels = outputs[i]->numChannels();
+    if (offset < (base + channels)) {
+      uint32_t n = base + channels - offset; // Channels left in this strip
+      if (n > dataLength)
+        n = dataLength;
+      outputs[i]->setChannels(offset - base, data, n);
+      changed |= 1UL << i;
+      data += n;
+      offset += n;
+      dataLength -= n;
+    }
+    base += channels;
+  }
+
+  packets++;
+  if ((flags & DDP_FLAG_PUSH) && autoShow) {
+    show();
+    frameLatency = micros() - frameStart;
+  }
+  packetLatency = micros() - start;
+  return true;
+}
+
+/*!
+  @brief   Call show() on each strip written since its last show().
+           Only needed if setAutoShow(false) was used.
+*/
+void Adafruit_NeoPixel_DDP::show(void) {
+  for (uint8_t i = 0; i < numOutputs; i++) {
+    if (changed & (1UL << i))
+      outputs[i]->show();
+  }
+  changed = 0;
+}
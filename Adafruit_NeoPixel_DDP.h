@@ -0,0 +1,114 @@
+/*!
+ * @file Adafruit_NeoPixel_DDP.h
+ *
+ * DDP (Distributed Display Protocol) receiver for the Adafruit_NeoPixel
+ * library.
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADAFRUIT_NEOPIXEL_DDP_H
+#define ADAFRUIT_NEOPIXEL_DDP_H
+
+#include "Adafruit_NeoPixel.h"
+
+#ifndef NEO_DDP_MAX_OUTPUTS
+#define NEO_DDP_MAX_OUTPUTS 4 ///< Max strips per receiver (up to 32)
+#endif
+#if NEO_DDP_MAX_OUTPUTS > 32
+#error "NEO_DDP_MAX_OUTPUTS must be 32 or less"
+#endif
+
+#define NEO_DDP_PORT 4048        ///< Standard DDP UDP port
+#define NEO_DDP_MAX_PACKET 1454  ///< Largest DDP packet handled by read()
+
+/*!
+    @brief  Class that decodes DDP packets into Adafruit_NeoPixel strips.
+            It doesn't depend on any particular network stack: pass each
+            received UDP payload to handlePacket(), or call read() with
+            any Arduino UDP object bound to NEO_DDP_PORT.
+
+            Strips added with addOutput() are concatenated into one
+            display, in order; DDP's data offset is a byte (channel)
+            offset into that, in R,G,B(,W) order per pixel.
+
+            read() receives into a NEO_DDP_MAX_PACKET (1454 byte) buffer
+            kept in the object rather than on the stack, so the receiver
+            takes about 1.5 KB of RAM; declare it globally, not as a
+            local variable.
+*/
+class Adafruit_NeoPixel_DDP {
+
+public:
+  Adafruit_NeoPixel_DDP(void);
+
+  bool addOutput(Adafruit_NeoPixel &strip);
+  bool handlePacket(const uint8_t *packet, uint16_t length);
+  void show(void);
+  /*!
+    @brief   Receive and handle one packet, if available, from an Arduino
+             UDP object.
+    @param   udp  Any object with Arduino's UDP parsePacket() and read()
+                  methods, already begun on NEO_DDP_PORT.
+    @return  true if a packet was received and accepted.
+  */
+  template <class UDP> bool read(UDP &udp) {
+    if (udp.parsePacket() <= 0)
+      return false;
+    int length = udp.read(rxBuffer, sizeof rxBuffer);
+    return (length > 0) && handlePacket(rxBuffer, length);
+  }
+  /*!
+    @brief   Set whether the receiver calls show() on strips itself when
+             a packet with the PUSH flag arrives.
+    @param   on  true (the default) to show automatically, false if the
+                 sketch will call show() itself.
+  */
+  void setAutoShow(bool on) { autoShow = on; }
+  /*!
+    @brief   Query the number of packets accepted.
+    @return  Packet count.
+  */
+  uint32_t getPacketCount(void) const { return packets; }
+  /*!
+    @brief   Query the time taken by handlePacket() on the most recent
+             accepted packet, including show() if it was a PUSH.
+    @return  Time in microseconds.
+  */
+  uint32_t getPacketLatency(void) const { return packetLatency; }
+  /*!
+    @brief   Query the time from arrival of the first packet of the most
+             recently pushed frame until its show() returned, i.e. how
+             long the strips lagged the sender's data.
+    @return  Time in microseconds.
+  */
+  uint32_t getFrameLatency(void) const { return frameLatency; }
+
+private:
+  Adafruit_NeoPixel *outputs[NEO_DDP_MAX_OUTPUTS]; ///< Strips, in order
+  uint32_t changed;       ///< Bitmask of outputs written since show()
+  uint32_t packets;       ///< Packets accepted
+  uint32_t frameStart;    ///< micros() at first packet of frame
+  uint32_t packetLatency; ///< handlePacket() time, last packet
+  uint32_t frameLatency;  ///< First packet to show() done, last frame
+  uint8_t numOutputs;     ///< Number of entries in outputs
+  bool autoShow;          ///< true if showing strips on PUSH
+  uint8_t rxBuffer[NEO_DDP_MAX_PACKET]; ///< Packet received by read()
+};
+
+#endif // ADAFRUIT_NEOPIXEL_DDP_H
@@ -0,0 +1,237 @@
+/*!
+ * @file Adafruit_NeoPixel_E131.cpp
+ *
+ * @section intro_sec Introduction
+ *
+ * E1.31 (sACN) receiver for the Adafruit_NeoPixel library. Follows
+ * ANSI E1.31-2016, including universe synchronization.
+ *
+ * @section license License
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "Adafruit_NeoPixel_E131.h"
+
+// Multi-byte packet fields are big-endian
+#define E131_WORD(p) (((uint16_t)(p)[0] << 8) | (p)[1])
+#define E131_LONG(p) (((uint32_t)E131_WORD(p) << 16) | E131_WORD((p) + 2))
+
+// Byte offsets of fields in data and sync packets
+#define E131_ROOT_VECTOR 18
+#define E131_FRAMING_VECTOR 40
+#define E131_DATA_SYNC 109
+#define E131_DATA_SEQUENCE 111
+#define E131_DATA_OPTIONS 112
+#define E131_DATA_UNIVERSE 113
+#define E131_DMP_VECTOR 117
+#define E131_DMP_TYPE 118
+#define E131_DMP_COUNT 123
+#define E131_DMP_START 125
+#define E131_DATA_SLOTS 126
+#define E131_SYNC_ADDRESS 45
+#define E131_SYNC_SIZE 49
+
+#define E131_OPTION_PREVIEW 0x80    // Data for preview displays only
+#define E131_OPTION_TERMINATED 0x40 // Source is stopping this universe
+
+static const uint8_t e131Preamble[16] = {0x00, 0x10, 0x00, 0x00, 'A', 'S',
+                                         'C',  '-',  'E',  '1',  '.', '1',
+                                         '7',  0x00, 0x00, 0x00};
+
+/*!
+  @brief   E1.31 receiver constructor. Add strips with addOutput().
+*/
+Adafruit_NeoPixel_E131::Adafruit_NeoPixel_E131(void)
+    : packets(0), dropped(0), channelsPerUniverse(510), syncAddress(0),
+      numOutputs(0), nextSequence(0), autoShow(true) {
+  memset(sequences, 0, sizeof sequences);
+}
+
+/*!
+  @brief   Assign a strip to receive data, starting at a given universe
+           and DMX address and continuing through as many consecutive
+           universes as the strip needs.
+  @param   strip     Adafruit_NeoPixel object, already begun. Must outlive
+                     the receiver.
+  @param   universe  First universe, 1-63999.
+  @param   address   DMX address (1-512) of the first pixel's red channel
+                     within that universe. Default is 1.
+  @return  true on success, false if the receiver already has
+           NEO_E131_MAX_OUTPUTS strips or the arguments are out of range.
+*/
+bool Adafruit_NeoPixel_E131::addOutput(Adafruit_NeoPixel &strip,
+                                       uint16_t universe, uint16_t address) {
+  if ((numOutputs >= NEO_E131_MAX_OUTPUTS) || !universe ||
+      (universe > 63999) || !address || (address > 512))
+    return false;
+  Output &o = outputs[numOutputs++];
+  o.strip = &strip;
+  o.universe = universe;
+  o.address = address;
+  o.changed = false;
+  return true;
+}
+
+/*!
+  @brief   Process one received UDP payload, writing any pixel data it
+           carries into the strips.
+  @param   packet  Payload of a UDP packet received on NEO_E131_PORT.
+  @param   length  Payload size in bytes.
+  @return  true if the packet was a valid E1.31 data or sync packet and
+           was accepted, false if malformed, not E1.31, preview data or
+           out of sequence.
+*/
+bool Adafruit_NeoPixel_E131::handlePacket(const uint8_t *packet,
+                                          uint16_t length) {
+  if ((length < E131_SYNC_SIZE) ||
+      memcmp(packet, e131Preamble, sizeof e131Preamble))
+    return false;
+
+  uint32_t rootVector = E131_LONG(&packet[E131_ROOT_VECTOR]);
+  uint32_t framingVector = E131_LONG(&packet[E131_FRAMING_VECTOR]);
+
+  if ((rootVector == 0x00000008) && (framingVector == 0x00000001)) {
+    // Universe synchronization: show strips written with this sync
+    // address. No sequence check needed, as a repeated sync packet finds
+    // nothing pending.
+    uint16_t address = E131_WORD(&packet[E131_SYNC_ADDRESS]);
+    if (!address || (address != syncAddress))
+      return false;
+    syncAddress = 0;
+    packets++;
+    if (autoShow)
+      show();
+    return true;
+  }
+
+  if ((rootVector != 0x00000004) || (framingVector != 0x00000002) ||
+      (length < E131_DATA_SLOTS) || (packet[E131_DMP_VECTOR] != 0x02) ||
+      (packet[E131_DMP_TYPE] != 0xA1))
+    return false;
+
+  uint16_t count = E131_WORD(&packet[E131_DMP_COUNT]);
+  if (!count || (count > 513) || ((E131_DATA_SLOTS - 1 + count) > length))
+    return false;
+  uint8_t options = packet[E131_DATA_OPTIONS];
+  uint16_t universe = E131_WORD(&packet[E131_DATA_UNIVERSE]);
+  if (!sequence(universe, packet[E131_DATA_SEQUENCE],
+                options & E131_OPTION_TERMINATED) ||
+      (options & (E131_OPTION_PREVIEW | E131_OPTION_TERMINATED)) ||
+      packet[E131_DMP_START]) // Alternate start codes aren't pixel data
+    return false;
+
+  uint16_t slots = count - 1;
+  if (slots > channelsPerUniverse)
+    slots = channelsPerUniverse;
+  const uint8_t *data = &packet[E131_DATA_SLOTS];
+
+  for (uint8_t i = 0; i < numOutputs; i++) {
+    Output &o = outputs[i];
+    if (universe < o.universe)
+      continue;
+    // Strip channel corresponding to this universe's first slot; negative
+    // if the strip begins partway into it
+    int32_t channel = (int32_t)(universe - o.universe) * channelsPerUniverse -
+                      (o.address - 1);
+    uint16_t skip = 0;
+    if (channel < 0) {
+      skip = -channel;
+      channel = 0;
+    }
+    if ((skip >= slots) || (channel >= o.strip->numChannels()))
+      continue;
+    o.strip->setChannels(channel, data + skip, slots - skip);
+    o.changed = true;
+  }
+
+  packets++;
+  uint16_t sync = E131_WORD(&packet[E131_DATA_SYNC]);
+  if (sync) {
+    syncAddress = sync; // Hold until sync packet
+  } else if (autoShow) {
+    showIfDone(universe);
+  }
+  return true;
+}
+
+/*!
+  @brief   Call show() on each strip written since its last show().
+           Only needed if setAutoShow(false) was used.
+*/
+void Adafruit_NeoPixel_E131::show(void) {
+  for (uint8_t i = 0; i < numOutputs; i++) {
+    if (outputs[i].changed) {
+      outputs[i].strip->show();
+      outputs[i].changed = false;
+    }
+  }
+}
+
+/*!
+  @brief   Show strips whose last universe is the one just received.
+  @param   universe  Universe number.
+*/
+void Adafruit_NeoPixel_E131::showIfDone(uint16_t universe) {
+  for (uint8_t i = 0; i < numOutputs; i++) {
+    Output &o = outputs[i];
+    uint32_t channels = o.strip->numChannels();
+    uint16_t last = o.universe;
+    if (channels)
+      last += (o.address - 1 + channels - 1) / channelsPerUniverse;
+    if (o.changed && (universe == last)) {
+      o.strip->show();
+      o.changed = false;
+    }
+  }
+}
+
+/*!
+  @brief   Check a packet's sequence number against the last one seen on
+           its universe, per E1.31 section 6.7.2.
+  @param   universe    Universe number.
+  @param   seq         Sequence number from packet.
+  @param   terminated  true if source is ending the stream, so the next
+                       packet may start a new sequence.
+  @return  true if the packet is in sequence, false if it should be
+           discarded.
+*/
+bool Adafruit_NeoPixel_E131::sequence(uint16_t universe, uint8_t seq,
+                                      bool terminated) {
+  Sequence *s = NULL;
+  for (uint8_t i = 0; i < NEO_E131_MAX_UNIVERSES; i++) {
+    if (sequences[i].universe == universe) {
+      s = &sequences[i];
+      // Packets up to 20 behind the last are stale or duplicates; further
+      // back is taken as the source having restarted
+      int8_t diff = seq - s->seq;
+      if ((diff <= 0) && (diff > -20)) {
+        dropped++;
+        return false;
+      }
+      break;
+    }
+  }
+  if (!s) {
+    s = &sequences[nextSequence];
+    if (++nextSequence >= NEO_E131_MAX_UNIVERSES)
+      nextSequence = 0;
+  }
+  s->universe = terminated ? 0 : universe;
+  s->seq = seq;
+  return true;
+}
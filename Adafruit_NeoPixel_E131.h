@@ -0,0 +1,143 @@
+/*!
+ * @file Adafruit_NeoPixel_E131.h
+ *
+ * E1.31 (streaming ACN, "sACN") receiver for the Adafruit_NeoPixel
+ * library, mapping DMX universes onto one or more strips.
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADAFRUIT_NEOPIXEL_E131_H
+#define ADAFRUIT_NEOPIXEL_E131_H
+
+#include "Adafruit_NeoPixel.h"
+
+#ifndef NEO_E131_MAX_OUTPUTS
+#define NEO_E131_MAX_OUTPUTS 4 ///< Max strips per receiver
+#endif
+#ifndef NEO_E131_MAX_UNIVERSES
+#define NEO_E131_MAX_UNIVERSES 16 ///< Max universes tracked for sequencing
+#endif
+
+#define NEO_E131_PORT 5568       ///< Standard E1.31 UDP port
+#define NEO_E131_MAX_PACKET 638  ///< Largest E1.31 data packet in bytes
+
+/*!
+    @brief  Class that decodes E1.31 packets into Adafruit_NeoPixel strips.
+            It doesn't depend on any particular network stack: pass each
+            received UDP payload to handlePacket(), or call read() with
+            any Arduino UDP object (WiFiUDP, EthernetUDP, etc.) bound to
+            NEO_E131_PORT (and joined to the universes' multicast groups,
+            239.255.<universe high byte>.<universe low byte>, if used).
+
+            Each strip takes its channels, in R,G,B(,W) order, from
+            consecutive universes starting at a given universe and DMX
+            address. Universes hold 510 channels by default, so RGB pixels
+            don't straddle universes (170 per universe), as is usual with
+            pixel controllers; see setChannelsPerUniverse().
+
+            read() receives into a NEO_E131_MAX_PACKET (638 byte) buffer
+            kept in the object rather than on the stack, so the receiver
+            takes about 770 bytes of RAM; declare it globally, not as a
+            local variable.
+*/
+class Adafruit_NeoPixel_E131 {
+
+public:
+  Adafruit_NeoPixel_E131(void);
+
+  bool addOutput(Adafruit_NeoPixel &strip, uint16_t universe,
+                 uint16_t address = 1);
+  bool handlePacket(const uint8_t *packet, uint16_t length);
+  void show(void);
+  /*!
+    @brief   Receive and handle one packet, if available, from an Arduino
+             UDP object.
+    @param   udp  Any object with Arduino's UDP parsePacket() and read()
+                  methods, already begun on NEO_E131_PORT.
+    @return  true if a packet was received and accepted.
+  */
+  template <class UDP> bool read(UDP &udp) {
+    if (udp.parsePacket() <= 0)
+      return false;
+    int length = udp.read(rxBuffer, sizeof rxBuffer);
+    return (length > 0) && handlePacket(rxBuffer, length);
+  }
+  /*!
+    @brief   Set the number of channels used in each universe. Strips
+             continue into the next universe after this many.
+    @param   n  Channels per universe, 1-512. Default is 510 (170 RGB
+                pixels); RGBW setups commonly use 512 (128 pixels).
+  */
+  void setChannelsPerUniverse(uint16_t n) {
+    channelsPerUniverse = ((n >= 1) && (n <= 512)) ? n : 510;
+  }
+  /*!
+    @brief   Set whether the receiver calls show() on strips itself:
+             either when a strip's last universe arrives or, if the
+             sender uses universe synchronization, when the sync packet
+             arrives.
+    @param   on  true (the default) to show automatically, false if the
+                 sketch will call show() itself.
+  */
+  void setAutoShow(bool on) { autoShow = on; }
+  /*!
+    @brief   Query the number of packets accepted.
+    @return  Packet count.
+  */
+  uint32_t getPacketCount(void) const { return packets; }
+  /*!
+    @brief   Query the number of data packets discarded for arriving out
+             of sequence (late duplicates, or reordered by the network).
+    @return  Packet count.
+  */
+  uint32_t getDroppedCount(void) const { return dropped; }
+
+private:
+  bool sequence(uint16_t universe, uint8_t seq, bool terminated);
+  void showIfDone(uint16_t universe);
+
+  /*!
+    @brief  A strip and where its channels begin.
+  */
+  struct Output {
+    Adafruit_NeoPixel *strip; ///< Strip receiving data
+    uint16_t universe;        ///< First universe
+    uint16_t address;         ///< DMX address (1-512) of first channel
+    bool changed;             ///< true if written since last show()
+  } outputs[NEO_E131_MAX_OUTPUTS]; ///< Strips receiving data
+
+  /*!
+    @brief  Last sequence number seen on a universe.
+  */
+  struct Sequence {
+    uint16_t universe; ///< Universe number, 0 if entry unused
+    uint8_t seq;       ///< Last sequence number
+  } sequences[NEO_E131_MAX_UNIVERSES]; ///< Per-universe sequence numbers
+
+  uint32_t packets;             ///< Packets accepted
+  uint32_t dropped;             ///< Packets out of sequence
+  uint16_t channelsPerUniverse; ///< Channels used in each universe
+  uint16_t syncAddress;         ///< Pending sync universe, 0 if none
+  uint8_t numOutputs;           ///< Number of entries in outputs
+  uint8_t nextSequence;         ///< Next sequences entry to replace
+  bool autoShow;                ///< true if showing strips automatically
+  uint8_t rxBuffer[NEO_E131_MAX_PACKET]; ///< Packet received by read()
+};
+
+#endif // ADAFRUIT_NEOPIXEL_E131_H
@@ -0,0 +1,421 @@
+/*!
+ * @file Adafruit_NeoPixel_Matrix.cpp
+ *
+ * @section intro_sec Introduction
+ *
+ * 2D matrix addressing for the Adafruit_NeoPixel library. Layout
+ * handling follows the Adafruit_NeoMatrix library.
+ *
+ * @section license License
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "Adafruit_NeoPixel_Matrix.h"
+
+/*!
+  @brief   Matrix constructor. Call begin() before drawing.
+  @param   strip       Adafruit_NeoPixel object holding all the matrix's
+                       pixels, already begun. Must outlive the matrix.
+  @param   w           Width of one panel (or the whole matrix, if not
+                       tiled), in pixels.
+  @param   h           Height of one panel, in pixels.
+  @param   matrixType  Layout of pixels within a panel, and of panels
+                       within the matrix: NEO_MATRIX_* and NEO_TILE_*
+                       flags added together.
+  @param   tilesX      Number of panels across. Default is 1.
+  @param   tilesY      Number of panels down. Default is 1.
+*/
+Adafruit_NeoPixel_Matrix::Adafruit_NeoPixel_Matrix(Adafruit_NeoPixel &strip,
+                                                   uint16_t w, uint16_t h,
+                                                   uint8_t matrixType,
+                                                   uint8_t tilesX,
+                                                   uint8_t tilesY)
+    : strip(strip), table(NULL), WIDTH(w * tilesX), HEIGHT(h * tilesY),
+      matrixWidth(w), matrixHeight(h), type(matrixType), tilesX(tilesX),
+      tilesY(tilesY), rotation(0) {}
+
+/*!
+  @brief   Deallocate matrix.
+*/
+Adafruit_NeoPixel_Matrix::~Adafruit_NeoPixel_Matrix() { free(table); }
+
+/*!
+  @brief   Allocate and build the lookup table.
+  @return  true on success, false if there's insufficient RAM, in which
+           case the matrix still works but computes the mapping for each
+           pixel drawn.
+*/
+bool Adafruit_NeoPixel_Matrix::begin(void) {
+  free(table);
+  table = (uint16_t *)malloc((uint32_t)WIDTH * HEIGHT * sizeof(uint16_t));
+  buildTable();
+  return table != NULL;
+}
+
+/*!
+  @brief   Set the drawing rotation, rebuilding the lookup table.
+  @param   r  Quarter turns clockwise, 0-3 (as with Adafruit_GFX). Odd
+              values swap width() and height().
+  @note    To mirror the image, swap NEO_MATRIX_LEFT for NEO_MATRIX_RIGHT
+           (or TOP for BOTTOM) in the matrix type.
+*/
+void Adafruit_NeoPixel_Matrix::setRotation(uint8_t r) {
+  rotation = r & 3;
+  buildTable();
+}
+
+/*!
+  @brief   Fill the lookup table from mapXY() for the current rotation.
+*/
+void Adafruit_NeoPixel_Matrix::buildTable(void) {
+  if (!table)
+    return;
+  int16_t w = width(), h = height();
+  uint16_t *t = table;
+  for (int16_t y = 0; y < h; y++) {
+    for (int16_t x = 0; x < w; x++) {
+      *t++ = mapXY(x, y);
+    }
+  }
+}
+
+/*!
+  @brief   Compute the strip index of a matrix coordinate from the layout,
+           without the lookup table. XY() is the faster equivalent.
+  @param   x  Column, 0 to width()-1.
+  @param   y  Row, 0 to height()-1.
+  @return  Pixel index, or 0xFFFF if (x,y) is outside the matrix.
+*/
+uint16_t Adafruit_NeoPixel_Matrix::mapXY(int16_t x, int16_t y) const {
+  if ((x < 0) || (y < 0) || (x >= width()) || (y >= height()))
+    return 0xFFFF;
+
+  int16_t t;
+  switch (rotation) {
+  case 1:
+    t = x;
+    x = WIDTH - 1 - y;
+    y = t;
+    break;
+  case 2:
+    x = WIDTH - 1 - x;
+    y = HEIGHT - 1 - y;
+    break;
+  case 3:
+    t = x;
+    x = y;
+    y = HEIGHT - 1 - t;
+    break;
+  }
+
+  uint16_t major, minor, majorScale;
+
+  // Find tile, and its offset in the strip
+  uint16_t tx = x / matrixWidth, ty = y / matrixHeight;
+  x -= tx * matrixWidth; // Position within tile
+  y -= ty * matrixHeight;
+  uint8_t corner = type & NEO_TILE_CORNER;
+  if (corner & NEO_TILE_RIGHT)
+    tx = tilesX - 1 - tx;
+  if (corner & NEO_TILE_BOTTOM)
+    ty = tilesY - 1 - ty;
+  if ((type & NEO_TILE_AXIS) == NEO_TILE_ROWS) {
+    major = ty;
+    minor = tx;
+    majorScale = tilesX;
+  } else {
+    major = tx;
+    minor = ty;
+    majorScale = tilesY;
+  }
+  corner = type & NEO_MATRIX_CORNER;
+  if (((type & NEO_TILE_SEQUENCE) == NEO_TILE_ZIGZAG) && (major & 1)) {
+    // Alternate lines of tiles run backward, and are mounted rotated
+    // 180 degrees so cables reach, flipping the pixel corner too
+    minor = majorScale - 1 - minor;
+    corner ^= NEO_MATRIX_CORNER;
+  }
+  uint32_t tileOffset =
+      ((uint32_t)major * majorScale + minor) * matrixWidth * matrixHeight;
+
+  // Find pixel within tile
+  if (corner & NEO_MATRIX_RIGHT)
+    x = matrixWidth - 1 - x;
+  if (corner & NEO_MATRIX_BOTTOM)
+    y = matrixHeight - 1 - y;
+  if ((type & NEO_MATRIX_AXIS) == NEO_MATRIX_ROWS) {
+    major = y;
+    minor = x;
+    majorScale = matrixWidth;
+  } else {
+    major = x;
+    minor = y;
+    majorScale = matrixHeight;
+  }
+  if (((type & NEO_MATRIX_SEQUENCE) == NEO_MATRIX_ZIGZAG) && (major & 1))
+    minor = majorScale - 1 - minor;
+
+  return tileOffset + (uint32_t)major * majorScale + minor;
+}
+
+/*!
+  @brief   Look up the strip index of a matrix coordinate, e.g. for use
+           with the strip's setPixelColor() or getPixelColor().
+  @param   x  Column, 0 to width()-1.
+  @param   y  Row, 0 to height()-1.
+  @return  Pixel index, or 0xFFFF if (x,y) is outside the matrix.
+*/
+uint16_t Adafruit_NeoPixel_Matrix::XY(int16_t x, int16_t y) const {
+  if ((x < 0) || (y < 0) || (x >= width()) || (y >= height()))
+    return 0xFFFF;
+  return table ? table[(uint32_t)y * width() + x] : mapXY(x, y);
+}
+
+/*!
+  @brief   Convert a packed color to bytes in the strip's color order,
+           with brightness and color correction applied as setPixelColor()
+           does.
+  @param   c    Packed 32-bit WRGB color.
+  @param   out  4-byte buffer to receive the pixel's bytes.
+  @return  Bytes per pixel, 3 or 4.
+*/
+uint8_t Adafruit_NeoPixel_Matrix::colorBytes(uint32_t c, uint8_t *out) const {
+  uint8_t r = (uint8_t)(c >> 16), g = (uint8_t)(c >> 8), b = (uint8_t)c,
+          w = (uint8_t)(c >> 24);
+  strip.scaleColor(r, g, b, w);
+  uint8_t order = strip.getOrder();
+  out[(order >> 4) & 3] = r;
+  out[(order >> 2) & 3] = g;
+  out[order & 3] = b;
+  if (strip.bytesPerPixel() == 3)
+    return 3;
+  out[order >> 6] = w;
+  return 4;
+}
+
+/*!
+  @brief   Set one matrix pixel's color. Off-matrix coordinates are
+           ignored.
+  @param   x  Column, 0 to width()-1.
+  @param   y  Row, 0 to height()-1.
+  @param   c  Packed 32-bit RGB or WRGB color, as from the strip's
+              Color().
+*/
+void Adafruit_NeoPixel_Matrix::drawPixel(int16_t x, int16_t y, uint32_t c) {
+  uint16_t n = XY(x, y);
+  if (n < strip.numPixels()) {
+    uint8_t bytes[4], bpp = colorBytes(c, bytes);
+    uint8_t *p = &strip.getPixels()[n * bpp];
+    for (uint8_t i = 0; i < bpp; i++)
+      p[i] = bytes[i];
+  }
+}
+
+/*!
+  @brief   Fill a rectangle of matrix pixels with one color, clipped to
+           the matrix.
+  @param   x  Left column.
+  @param   y  Top row.
+  @param   w  Width in pixels.
+  @param   h  Height in pixels.
+  @param   c  Packed 32-bit RGB or WRGB color.
+*/
+void Adafruit_NeoPixel_Matrix::fillRect(int16_t x, int16_t y, int16_t w,
+                                        int16_t h, uint32_t c) {
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (w > (width() - x))
+    w = width() - x;
+  if (h > (height() - y))
+    h = height() - y;
+  if ((w <= 0) || (h <= 0))
+    return;
+
+  uint8_t bytes[4], bpp = colorBytes(c, bytes);
+  for (int16_t row = y; row < (y + h); row++) {
+    for (int16_t col = x; col < (x + w); col++) {
+      uint16_t n = table ? table[(uint32_t)row * width() + col]
+                         : mapXY(col, row);
+      if (n < strip.numPixels()) {
+        uint8_t *p = &strip.getPixels()[n * bpp];
+        for (uint8_t i = 0; i < bpp; i++)
+          p[i] = bytes[i];
+      }
+    }
+  }
+}
+
+/*!
+  @brief   Clip an image placed at (x,y) to the matrix.
+  @param   x     Column for image's left edge.
+  @param   y     Row for image's top edge.
+  @param   w     Image width in pixels.
+  @param   h     Image height in pixels.
+  @param   col0  Receives first visible image column.
+  @param   col1  Receives image column after last visible one.
+  @param   row0  Receives first visible image row.
+  @param   row1  Receives image row after last visible one.
+  @return  true if any of the image is visible.
+*/
+bool Adafruit_NeoPixel_Matrix::clip(int16_t x, int16_t y, int16_t w,
+                                    int16_t h, int16_t &col0, int16_t &col1,
+                                    int16_t &row0, int16_t &row1) const {
+  col0 = (x < 0) ? -x : 0;
+  row0 = (y < 0) ? -y : 0;
+  col1 = ((x + w) > width()) ? width() - x : w;
+  row1 = ((y + h) > height()) ? height() - y : h;
+  return (col0 < col1) && (row0 < row1);
+}
+
+/*!
+  @brief   Copy an image of packed colors to the matrix, clipped to the
+           matrix.
+  @param   x    Column for image's left edge.
+  @param   y    Row for image's top edge.
+  @param   img  Image, w*h packed 32-bit RGB or WRGB colors, row-major.
+  @param   w    Image width in pixels.
+  @param   h    Image height in pixels.
+*/
+void Adafruit_NeoPixel_Matrix::blit(int16_t x, int16_t y, const uint32_t *img,
+                                    int16_t w, int16_t h) {
+  int16_t col0, col1, row0, row1;
+  if (!clip(x, y, w, h, col0, col1, row0, row1))
+    return;
+  for (int16_t row = row0; row < row1; row++) {
+    const uint32_t *src = &img[(uint32_t)row * w + col0];
+    for (int16_t col = col0; col < col1; col++) {
+      uint16_t n = XY(x + col, y + row);
+      uint32_t c = *src++;
+      if (n < strip.numPixels()) {
+        uint8_t bytes[4], bpp = colorBytes(c, bytes);
+        uint8_t *p = &strip.getPixels()[n * bpp];
+        for (uint8_t i = 0; i < bpp; i++)
+          p[i] = bytes[i];
+      }
+    }
+  }
+}
+
+/*!
+  @brief   Copy an RGB565 image (as used by Adafruit_GFX, TFT displays and
+           many image decoders) to the matrix, clipped to the matrix. The
+           image is read in order, in one pass, converting each pixel to
+           the strip's color order, brightness and color correction as it's
+           stored.
+  @param   x    Column for image's left edge.
+  @param   y    Row for image's top edge.
+  @param   img  Image, w*h 16-bit RGB565 colors, row-major.
+  @param   w    Image width in pixels.
+  @param   h    Image height in pixels.
+  @note    On RGBW strips, the white element is set to 0.
+*/
+void Adafruit_NeoPixel_Matrix::blitRGB565(int16_t x, int16_t y,
+                                          const uint16_t *img, int16_t w,
+                                          int16_t h) {
+  int16_t col0, col1, row0, row1;
+  if (!clip(x, y, w, h, col0, col1, row0, row1))
+    return;
+
+  // Expand 5- and 6-bit components to 8 bits (replicating high bits into
+  // the low ones so full scale maps to 255), with brightness and color
+  // correction applied, once per call rather than per pixel
+  uint8_t lutR[32], lutG[64], lutB[32];
+  const uint16_t *s = strip.getScale();
+  for (uint8_t i = 0; i < 32; i++) {
+    uint8_t v = (i << 3) | (i >> 2);
+    lutR[i] = s ? (v * s[0]) >> 8 : v;
+    lutB[i] = s ? (v * s[2]) >> 8 : v;
+  }
+  for (uint8_t i = 0; i < 64; i++) {
+    uint8_t v = (i << 2) | (i >> 4);
+    lutG[i] = s ? (v * s[1]) >> 8 : v;
+  }
+
+  uint8_t order = strip.getOrder(), rOffset = (order >> 4) & 3,
+          gOffset = (order >> 2) & 3, bOffset = order & 3,
+          wOffset = order >> 6, bpp = strip.bytesPerPixel();
+  uint16_t numLEDs = strip.numPixels();
+  uint8_t *pixels = strip.getPixels();
+  for (int16_t row = row0; row < row1; row++) {
+    const uint16_t *src = &img[(uint32_t)row * w + col0];
+    for (int16_t col = col0; col < col1; col++) {
+      uint16_t v = *src++, n = XY(x + col, y + row);
+      if (n < numLEDs) {
+        uint8_t *p = &pixels[n * bpp];
+        if (bpp == 4)
+          p[wOffset] = 0;
+        p[rOffset] = lutR[v >> 11];
+        p[gOffset] = lutG[(v >> 5) & 0x3F];
+        p[bOffset] = lutB[v & 0x1F];
+      }
+    }
+  }
+}
+
+/*!
+  @brief   Copy an RGB888 image (3 bytes per pixel, in R,G,B order) to the
+           matrix, clipped to the matrix. The image is read in order, in
+           one pass, converting each pixel to the strip's color order,
+           brightness and color correction as it's stored.
+  @param   x    Column for image's left edge.
+  @param   y    Row for image's top edge.
+  @param   img  Image, w*h*3 bytes, row-major.
+  @param   w    Image width in pixels.
+  @param   h    Image height in pixels.
+  @note    On RGBW strips, the white element is set to 0.
+*/
+void Adafruit_NeoPixel_Matrix::blitRGB888(int16_t x, int16_t y,
+                                          const uint8_t *img, int16_t w,
+                                          int16_t h) {
+  int16_t col0, col1, row0, row1;
+  if (!clip(x, y, w, h, col0, col1, row0, row1))
+    return;
+
+  uint8_t order = strip.getOrder(), rOffset = (order >> 4) & 3,
+          gOffset = (order >> 2) & 3, bOffset = order & 3,
+          wOffset = order >> 6, bpp = strip.bytesPerPixel();
+  const uint16_t *s = strip.getScale();
+  uint16_t numLEDs = strip.numPixels();
+  uint8_t *pixels = strip.getPixels();
+  for (int16_t row = row0; row < row1; row++) {
+    const uint8_t *src = &img[((uint32_t)row * w + col0) * 3];
+    for (int16_t col = col0; col < col1; col++, src += 3) {
+      uint16_t n = XY(x + col, y + row);
+      if (n < numLEDs) {
+        uint8_t *p = &pixels[n * bpp];
+        if (bpp == 4)
+          p[wOffset] = 0;
+        if (s) { // See notes in setBrightness()
+          p[rOffset] = (src[0] * s[0]) >> 8;
+          p[gOffset] = (src[1] * s[1]) >> 8;
+          p[bOffset] = (src[2] * s[2]) >> 8;
+        } else {
+          p[rOffset] = src[0];
+          p[gOffset] = src[1];
+          p[bOffset] = src[2];
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,129 @@
+/*!
+ * @file Adafruit_NeoPixel_Matrix.h
+ *
+ * 2D matrix addressing for NeoPixel panels and grids of panels, via a
+ * precomputed XY-to-pixel-index lookup table.
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADAFRUIT_NEOPIXEL_MATRIX_H
+#define ADAFRUIT_NEOPIXEL_MATRIX_H
+
+#include "Adafruit_NeoPixel.h"
+
+// Matrix layout flags, the same values as the Adafruit_NeoMatrix library
+// so existing layout descriptions carry over. Add together one of each
+// group for the panel (NEO_MATRIX_*) and, if tiled, for the arrangement
+// of panels (NEO_TILE_*).
+#ifndef NEO_MATRIX_TOP
+
+// First pixel's position: top or bottom, left or right
+#define NEO_MATRIX_TOP 0x00    ///< Pixel 0 is at top of matrix
+#define NEO_MATRIX_BOTTOM 0x01 ///< Pixel 0 is at bottom of matrix
+#define NEO_MATRIX_LEFT 0x00   ///< Pixel 0 is at left of matrix
+#define NEO_MATRIX_RIGHT 0x02  ///< Pixel 0 is at right of matrix
+#define NEO_MATRIX_CORNER 0x03 ///< Bitmask for pixel 0 matrix corner
+// Pixels arranged in horizontal rows or vertical columns
+#define NEO_MATRIX_ROWS 0x00    ///< Matrix is row major (horizontal)
+#define NEO_MATRIX_COLUMNS 0x04 ///< Matrix is column major (vertical)
+#define NEO_MATRIX_AXIS 0x04    ///< Bitmask for row/column layout
+// Rows/columns all run the same direction, or alternate (serpentine)
+#define NEO_MATRIX_PROGRESSIVE 0x00 ///< Same pixel order across each line
+#define NEO_MATRIX_ZIGZAG 0x08      ///< Pixel order reverses between lines
+#define NEO_MATRIX_SEQUENCE 0x08    ///< Bitmask for pixel line order
+
+// Same for tiles: first tile's position, row/column, and order
+#define NEO_TILE_TOP 0x00         ///< First tile is at top of matrix
+#define NEO_TILE_BOTTOM 0x10      ///< First tile is at bottom of matrix
+#define NEO_TILE_LEFT 0x00        ///< First tile is at left of matrix
+#define NEO_TILE_RIGHT 0x20       ///< First tile is at right of matrix
+#define NEO_TILE_CORNER 0x30      ///< Bitmask for first tile corner
+#define NEO_TILE_ROWS 0x00        ///< Tiles ordered in rows
+#define NEO_TILE_COLUMNS 0x40     ///< Tiles ordered in columns
+#define NEO_TILE_AXIS 0x40        ///< Bitmask for tile H/V orientation
+#define NEO_TILE_PROGRESSIVE 0x00 ///< Same tile order across each line
+#define NEO_TILE_ZIGZAG 0x80      ///< Tile order reverses between lines
+#define NEO_TILE_SEQUENCE 0x80    ///< Bitmask for tile line order
+
+#endif // NEO_MATRIX_TOP
+
+/*!
+    @brief  Class that addresses an Adafruit_NeoPixel strip as a 2D
+            matrix. The XY mapping is computed once, into a table of
+            2 bytes per pixel, so drawing costs a table lookup per pixel
+            rather than the layout math. Drawing functions write colors
+            straight into the strip's pixel buffer; call the strip's
+            show() as usual to display them.
+*/
+class Adafruit_NeoPixel_Matrix {
+
+public:
+  Adafruit_NeoPixel_Matrix(Adafruit_NeoPixel &strip, uint16_t w, uint16_t h,
+                           uint8_t matrixType = NEO_MATRIX_TOP +
+                                                NEO_MATRIX_LEFT +
+                                                NEO_MATRIX_ROWS,
+                           uint8_t tilesX = 1, uint8_t tilesY = 1);
+  ~Adafruit_NeoPixel_Matrix();
+
+  bool begin(void);
+  void setRotation(uint8_t r);
+  void drawPixel(int16_t x, int16_t y, uint32_t c);
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint32_t c);
+  void blit(int16_t x, int16_t y, const uint32_t *img, int16_t w, int16_t h);
+  void blitRGB565(int16_t x, int16_t y, const uint16_t *img, int16_t w,
+                  int16_t h);
+  void blitRGB888(int16_t x, int16_t y, const uint8_t *img, int16_t w,
+                  int16_t h);
+  uint16_t XY(int16_t x, int16_t y) const;
+  uint16_t mapXY(int16_t x, int16_t y) const;
+  /*!
+    @brief   Get the matrix width, accounting for rotation.
+    @return  Width in pixels.
+  */
+  int16_t width(void) const { return (rotation & 1) ? HEIGHT : WIDTH; }
+  /*!
+    @brief   Get the matrix height, accounting for rotation.
+    @return  Height in pixels.
+  */
+  int16_t height(void) const { return (rotation & 1) ? WIDTH : HEIGHT; }
+  /*!
+    @brief   Get the current rotation.
+    @return  0-3, as passed to setRotation().
+  */
+  uint8_t getRotation(void) const { return rotation; }
+
+private:
+  void buildTable(void);
+  bool clip(int16_t x, int16_t y, int16_t w, int16_t h, int16_t &col0,
+            int16_t &col1, int16_t &row0, int16_t &row1) const;
+  uint8_t colorBytes(uint32_t c, uint8_t *out) const;
+
+  Adafruit_NeoPixel &strip; ///< Strip being addressed
+  uint16_t *table;          ///< XY-to-index lookup, row-major, or NULL
+  uint16_t WIDTH;           ///< Unrotated width of whole matrix
+  uint16_t HEIGHT;          ///< Unrotated height of whole matrix
+  uint16_t matrixWidth;     ///< Width of one tile
+  uint16_t matrixHeight;    ///< Height of one tile
+  uint8_t type;             ///< NEO_MATRIX_* and NEO_TILE_* flags
+  uint8_t tilesX;           ///< Number of tiles across
+  uint8_t tilesY;           ///< Number of tiles down
+  uint8_t rotation;         ///< 0-3, quarter turns clockwise
+};
+
+#endif // ADAFRUIT_NEOPIXEL_MATRIX_H
@@ -0,0 +1,272 @@
+/*!
+ * @file Adafruit_NeoPixel_Particles.cpp
+ *
+ * @section intro_sec Introduction
+ *
+ * Particle system for the Adafruit_NeoPixel library.
+ *
+ * @section license License
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "Adafruit_NeoPixel_Particles.h"
+
+/*!
+  @brief   Particle system constructor. Call begin() before use.
+  @param   strip  Adafruit_NeoPixel object, already begun. Must outlive
+                  the particle system.
+*/
+Adafruit_NeoPixel_Particles::Adafruit_NeoPixel_Particles(
+    Adafruit_NeoPixel &strip)
+    : strip(strip), particles(NULL), emitterColor(0), emitterPos(0),
+      emitterPosSpread(0), emitterVelSpread(0), emitterVel(0),
+      emitterRate(0), emitterAccum(0), capacity(0), numLive(0), seed(1),
+      gravity(0), emitterDecay(0), trail(0), erased(false) {}
+
+/*!
+  @brief   Deallocate particle system.
+*/
+Adafruit_NeoPixel_Particles::~Adafruit_NeoPixel_Particles() {
+  free(particles);
+}
+
+/*!
+  @brief   Allocate the particle pool. No further allocation is done.
+  @param   capacity  Maximum number of live particles.
+  @return  true on success, false if there's insufficient RAM.
+*/
+bool Adafruit_NeoPixel_Particles::begin(uint16_t capacity) {
+  free(particles);
+  numLive = 0;
+  particles = (neoParticle *)malloc(capacity * sizeof(neoParticle));
+  this->capacity = particles ? capacity : 0;
+  seed = (uint16_t)micros() | 1; // xorshift state must be nonzero
+  return particles != NULL;
+}
+
+/*!
+  @brief   Add a particle, drawn from the next update().
+  @param   pos    Position in 1/256 pixel units (e.g. 256 * 10 for pixel
+                  10).
+  @param   vel    Velocity in 1/256 pixels per frame; negative moves
+                  toward pixel 0.
+  @param   color  32-bit color value, as from the strip's Color().
+                  Brightness and color correction are applied as of this
+                  call.
+  @param   decay  Life (intensity, out of 255) lost per frame. 0 lives
+                  until the particle leaves the strip.
+  @param   life   Initial life (intensity). Default is 255, full color.
+  @return  true on success, false if the pool is full.
+*/
+bool Adafruit_NeoPixel_Particles::spawn(int32_t pos, int16_t vel,
+                                        uint32_t color, uint8_t decay,
+                                        uint8_t life) {
+  if ((numLive >= capacity) || !life)
+    return false;
+  neoParticle &p = particles[numLive++];
+  p.pos = pos;
+  p.vel = vel;
+  p.life = life;
+  p.decay = decay;
+  p.drawn = false;
+  uint8_t r = (uint8_t)(color >> 16), g = (uint8_t)(color >> 8),
+          b = (uint8_t)color, w = (uint8_t)(color >> 24);
+  strip.scaleColor(r, g, b, w);
+  uint8_t order = strip.getOrder();
+  p.color[(order >> 4) & 3] = r;
+  p.color[(order >> 2) & 3] = g;
+  p.color[order & 3] = b;
+  if (strip.bytesPerPixel() == 4)
+    p.color[order >> 6] = w;
+  return true;
+}
+
+/*!
+  @brief   Configure an emitter that spawns particles on each update(),
+           e.g. at the base of a fire or the head of a comet.
+  @param   pos        Position in 1/256 pixel units.
+  @param   posSpread  Random variation either side of pos, same units.
+  @param   vel        Velocity in 1/256 pixels per frame.
+  @param   velSpread  Random variation either side of vel, same units.
+  @param   color      32-bit color value, as from the strip's Color().
+  @param   decay      Life lost per frame, as for spawn().
+  @param   rate       Particles per frame, 8.8 fixed point (e.g. 128 for
+                      one every other frame). 0 turns the emitter off.
+*/
+void Adafruit_NeoPixel_Particles::setEmitter(int32_t pos, uint16_t posSpread,
+                                             int16_t vel, uint16_t velSpread,
+                                             uint32_t color, uint8_t decay,
+                                             uint16_t rate) {
+  emitterPos = pos;
+  emitterPosSpread = posSpread;
+  emitterVel = vel;
+  emitterVelSpread = velSpread;
+  emitterColor = color;
+  emitterDecay = decay;
+  emitterRate = rate;
+}
+
+/*!
+  @brief   Remove all particles, subtracting them from the pixels they
+           occupied.
+*/
+void Adafruit_NeoPixel_Particles::clear(void) {
+  for (uint16_t i = 0; i < numLive; i++)
+    erase(particles[i]);
+  numLive = 0;
+  erased = true;
+}
+
+/*!
+  @brief   Advance all particles by one frame and draw them into the
+           strip's pixels: expire, move, then draw each. Call once per
+           frame, then show() the strip if it returns true.
+  @param   now  Unused; particles move per frame, not per unit of time.
+  @return  true if any pixels changed.
+*/
+bool Adafruit_NeoPixel_Particles::update(uint32_t now) {
+  (void)now;
+  bool changed = erased;
+  erased = false;
+  if (trail) {
+    uint8_t *p = strip.getPixels();
+    for (uint16_t i = 0; i < strip.numChannels(); i++)
+      p[i] = (p[i] * trail) >> 8;
+    changed = true;
+  } else {
+    for (uint16_t i = 0; i < numLive; i++) {
+      if (particles[i].drawn) {
+        erase(particles[i]);
+        changed = true;
+      }
+    }
+  }
+
+  if (emitterRate) {
+    uint32_t accum = (uint32_t)emitterAccum + emitterRate;
+    for (; accum >= 256; accum -= 256) {
+      spawn(spread(emitterPos, emitterPosSpread),
+            spread(emitterVel, emitterVelSpread), emitterColor,
+            emitterDecay);
+    }
+    emitterAccum = accum;
+  }
+
+  int32_t end = (int32_t)strip.numPixels() << 8;
+  for (uint16_t i = 0; i < numLive;) {
+    neoParticle &p = particles[i];
+    if (p.decay >= p.life) {
+      p = particles[--numLive]; // Expired; last live one takes its place
+      continue;
+    }
+    p.life -= p.decay;
+    p.vel += gravity;
+    p.pos += p.vel;
+    if ((p.pos <= -256) || (p.pos >= end)) {
+      p = particles[--numLive]; // Left the strip
+      continue;
+    }
+    draw(p);
+    changed = true;
+    i++;
+  }
+  return changed;
+}
+
+/*!
+  @brief   Subtract what draw() added from the pixels a particle covers,
+           leaving whatever was there before. Saturates at 0 in case the
+           pixels have since been redrawn by other means.
+  @param   p  Particle, at the position it was drawn.
+*/
+void Adafruit_NeoPixel_Particles::erase(neoParticle &p) {
+  if (!p.drawn)
+    return;
+  p.drawn = false;
+  uint8_t bpp = strip.bytesPerPixel();
+  int32_t i = p.pos >> 8;
+  if (i >= 0) {
+    uint8_t *px = &strip.getPixels()[i * bpp];
+    for (uint8_t k = 0; k < bpp; k++)
+      px[k] = (px[k] > p.added[0][k]) ? px[k] - p.added[0][k] : 0;
+  }
+  if ((p.pos & 0xFF) && ((i + 1) < strip.numPixels())) {
+    uint8_t *px = &strip.getPixels()[(i + 1) * bpp];
+    for (uint8_t k = 0; k < bpp; k++)
+      px[k] = (px[k] > p.added[1][k]) ? px[k] - p.added[1][k] : 0;
+  }
+}
+
+/*!
+  @brief   Add a particle's color into the one or two pixels it covers,
+           split by its sub-pixel position, saturating at 255. The
+           amounts actually added are kept for erase().
+  @param   p  Particle, within the strip.
+*/
+void Adafruit_NeoPixel_Particles::draw(neoParticle &p) {
+  uint8_t bpp = strip.bytesPerPixel();
+  int32_t i = p.pos >> 8;
+  uint8_t f = p.pos & 0xFF;
+  // Intensity per pixel; +1 as with brightness, so 255 is full color
+  uint8_t a1 = (p.life * f) >> 8, a0 = p.life - a1;
+  if (i >= 0) {
+    uint8_t *px = &strip.getPixels()[i * bpp];
+    for (uint8_t k = 0; k < bpp; k++) {
+      uint16_t v = px[k] + ((p.color[k] * (a0 + 1)) >> 8);
+      if (v > 255)
+        v = 255;
+      p.added[0][k] = v - px[k];
+      px[k] = v;
+    }
+  }
+  if (f && ((i + 1) < strip.numPixels())) {
+    uint8_t *px = &strip.getPixels()[(i + 1) * bpp];
+    for (uint8_t k = 0; k < bpp; k++) {
+      uint16_t v = px[k] + ((p.color[k] * (a1 + 1)) >> 8);
+      if (v > 255)
+        v = 255;
+      p.added[1][k] = v - px[k];
+      px[k] = v;
+    }
+  }
+  p.drawn = true;
+}
+
+/*!
+  @brief   Generate a pseudorandom number (16-bit xorshift; cheap on 8-bit
+           CPUs, and no division as with random(min, max)).
+  @return  Pseudorandom value, 1-65535.
+*/
+uint16_t Adafruit_NeoPixel_Particles::rand16(void) {
+  seed ^= seed << 7;
+  seed ^= seed >> 9;
+  seed ^= seed << 8;
+  return seed;
+}
+
+/*!
+  @brief   Vary a value randomly.
+  @param   value  Central value.
+  @param   range  Maximum variation either side.
+  @return  value - range to value + range.
+*/
+int32_t Adafruit_NeoPixel_Particles::spread(int32_t value, uint16_t range) {
+  if (!range)
+    return value;
+  return value - range + (int32_t)(((uint32_t)rand16() * range) >> 15);
+}
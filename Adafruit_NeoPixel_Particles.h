@@ -0,0 +1,126 @@
+/*!
+ * @file Adafruit_NeoPixel_Particles.h
+ *
+ * Fixed-capacity particle system (fire, sparkles, comets and similar)
+ * drawing into a NeoPixel strip.
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADAFRUIT_NEOPIXEL_PARTICLES_H
+#define ADAFRUIT_NEOPIXEL_PARTICLES_H
+
+#include "Adafruit_NeoPixel.h"
+#include "Adafruit_NeoPixel_Scheduler.h"
+
+/*!
+    @brief  One particle. Positions and velocities are fixed point with 8
+            fractional bits, i.e. in 1/256ths of a pixel.
+*/
+typedef struct {
+  int32_t pos;         ///< Position, 1/256 pixel units
+  int16_t vel;         ///< Velocity, 1/256 pixels per frame
+  uint8_t color[4];    ///< Color in strip byte order, brightness applied
+  uint8_t life;        ///< Remaining life, also intensity; 0 = dead
+  uint8_t decay;       ///< Life lost per frame
+  uint8_t added[2][4]; ///< Amount drawn into each covered pixel
+  bool drawn;          ///< true if drawn at pos since last erased
+} neoParticle;
+
+/*!
+    @brief  Class that animates a pool of particles along a strip, each
+            with its own position, velocity, color and rate of decay,
+            spawned individually or by an emitter. Particles are drawn
+            with sub-pixel positioning, their intensity split between the
+            two pixels they straddle, and added (saturating) to what's
+            already there, so overlapping particles brighten.
+
+            The pool is allocated once by begin(); spawning and expiring
+            particles only moves entries within it. Each frame's cost is
+            proportional to the number of live particles, not the strip
+            length: by default, what each particle added to the strip
+            last frame is subtracted again rather than clearing the
+            strip, so particles can move over a background or another
+            effect's pixels without wiping them. With setTrail(), the
+            whole strip is faded instead, leaving trails behind moving
+            particles, at a cost per pixel; anything else drawn into the
+            strip fades with them.
+
+            It's an Adafruit_NeoPixel_Effect, so it can be run by an
+            Adafruit_NeoPixel_Scheduler, or by calling update() directly.
+*/
+class Adafruit_NeoPixel_Particles : public Adafruit_NeoPixel_Effect {
+
+public:
+  Adafruit_NeoPixel_Particles(Adafruit_NeoPixel &strip);
+  ~Adafruit_NeoPixel_Particles();
+
+  bool begin(uint16_t capacity);
+  bool spawn(int32_t pos, int16_t vel, uint32_t color, uint8_t decay,
+             uint8_t life = 255);
+  void setEmitter(int32_t pos, uint16_t posSpread, int16_t vel,
+                  uint16_t velSpread, uint32_t color, uint8_t decay,
+                  uint16_t rate);
+  /*!
+    @brief   Set a constant acceleration applied to every particle each
+             frame, e.g. negative to make sparks fall back toward pixel 0.
+    @param   accel  Acceleration in 1/256 pixels per frame per frame.
+  */
+  void setGravity(int16_t accel) { gravity = accel; }
+  /*!
+    @brief   Leave fading trails behind particles by scaling the whole
+             strip each frame, instead of clearing only the pixels
+             particles occupied.
+    @param   keep  Fraction of each pixel's value kept per frame, in
+                   1/256ths (e.g. 192 keeps 75%). 0 (the default)
+                   disables trails.
+  */
+  void setTrail(uint8_t keep) { trail = keep; }
+  bool update(uint32_t now);
+  void clear(void);
+  /*!
+    @brief   Query the number of live particles.
+    @return  Particle count.
+  */
+  uint16_t numParticles(void) const { return numLive; }
+
+private:
+  void erase(neoParticle &p);
+  void draw(neoParticle &p);
+  uint16_t rand16(void);
+  int32_t spread(int32_t value, uint16_t range);
+
+  Adafruit_NeoPixel &strip;  ///< Strip drawn into
+  neoParticle *particles;    ///< Pool; live particles come first
+  uint32_t emitterColor;     ///< Emitter particle color
+  int32_t emitterPos;        ///< Emitter position, 1/256 pixel units
+  uint16_t emitterPosSpread; ///< Random +/- spread of emitter position
+  uint16_t emitterVelSpread; ///< Random +/- spread of emitter velocity
+  int16_t emitterVel;        ///< Emitter particle velocity
+  uint16_t emitterRate;      ///< Particles per frame, 8.8 fixed point
+  uint16_t emitterAccum;     ///< Fractional particles carried over
+  uint16_t capacity;         ///< Size of pool
+  uint16_t numLive;          ///< Number of live particles
+  uint16_t seed;             ///< rand16() state
+  int16_t gravity;           ///< Acceleration, 1/256 pixels/frame/frame
+  uint8_t emitterDecay;      ///< Emitter particle decay
+  uint8_t trail;             ///< Fraction kept per frame, 0 = no trails
+  bool erased;               ///< true if clear() left pixels to show
+};
+
+#endif // ADAFRUIT_NEOPIXEL_PARTICLES_H
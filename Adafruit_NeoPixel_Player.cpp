@@ -0,0 +1,356 @@
+/*!
+ * @file Adafruit_NeoPixel_Player.cpp
+ *
+ * @section intro_sec Introduction
+ *
+ * Playback of precomputed animations for the Adafruit_NeoPixel library.
+ * See Adafruit_NeoPixel_Player.h for the data format.
+ *
+ * @section license License
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "Adafruit_NeoPixel_Player.h"
+
+// Animation data is read through pgm_read_byte() and memcpy_P() so it
+// can live in PROGMEM on AVR; elsewhere these are plain memory accesses.
+#define ANIM_BYTE(offset) pgm_read_byte(data + (offset))
+#define ANIM_WORD(offset) (ANIM_BYTE(offset) | (ANIM_BYTE((offset) + 1) << 8))
+
+/*!
+  @brief   Animation player constructor.
+  @param   strip  Adafruit_NeoPixel object that frames are decoded into
+                  and shown on. Must outlive the player.
+*/
+Adafruit_NeoPixel_Player::Adafruit_NeoPixel_Player(Adafruit_NeoPixel &strip)
+    : strip(strip), data(NULL), length(0), pos(0), nextTime(0), numPixels(0),
+      frames(0), frame(0), changedFirst(0), changedCount(0), order(0), bpp(3),
+      fps(0), looping(true), timed(false) {}
+
+/*!
+  @brief   Start playing an animation from the first frame.
+  @param   data    Animation data, as described in
+                   Adafruit_NeoPixel_Player.h. On AVR this must be in
+                   PROGMEM; elsewhere it may be in flash or RAM. Not
+                   copied, must remain valid for the duration of playback.
+  @param   length  Size of animation data in bytes.
+  @return  true if the header is valid, false otherwise (nothing will
+           play).
+*/
+bool Adafruit_NeoPixel_Player::begin(const uint8_t *data, uint32_t length) {
+  this->data = NULL;
+  frames = 0;
+  fps = 0;
+  if (!data || (length < NEO_ANIM_HEADER_SIZE) ||
+      (pgm_read_byte(&data[0]) != 'N') || (pgm_read_byte(&data[1]) != 'P') ||
+      (pgm_read_byte(&data[2]) != 'X') || (pgm_read_byte(&data[3]) != 'A'))
+    return false;
+
+  this->data = data;
+  this->length = length;
+  numPixels = ANIM_WORD(4);
+  order = ANIM_BYTE(6);
+  bpp = (((order >> 6) & 3) == ((order >> 4) & 3)) ? 3 : 4;
+  fps = ANIM_BYTE(7);
+  frames = ANIM_WORD(8);
+  if (!numPixels || !fps || !frames)
+    return stop();
+
+  timed = false;
+  rewind();
+  return true;
+}
+
+/*!
+  @brief   Call frequently from loop(). When the next frame is due
+           (according to the animation's frame rate), decodes it into
+           the strip and calls the strip's show().
+  @return  true if a new frame was shown, false if not due yet or if
+           playback is done().
+  @note    Frame times are scheduled from the prior frame's deadline
+           rather than from when update() happened to be called, so the
+           average rate holds steady. If the sketch falls more than a
+           frame behind, playback resynchronizes rather than rushing
+           frames to catch up.
+*/
+bool Adafruit_NeoPixel_Player::update(void) {
+  if (done())
+    return false;
+  uint32_t now = micros(), interval = 1000000UL / fps;
+  if (timed && ((int32_t)(now - nextTime) < 0))
+    return false; // Not yet
+  if (!nextFrame())
+    return false;
+  strip.show();
+  nextTime = (timed && ((now - nextTime) < interval)) ? nextTime + interval
+                                                      : now + interval;
+  timed = true;
+  return true;
+}
+
+/*!
+  @brief   Decode the next frame into the strip's pixel buffer, without
+           calling show() or observing frame timing; for sketches that
+           do their own scheduling or draw over the animation.
+  @return  true on success, false if playback is done() or the data is
+           malformed (which stops playback).
+*/
+bool Adafruit_NeoPixel_Player::nextFrame(void) {
+  if (!data)
+    return false;
+  if (frame >= frames) {
+    if (!looping)
+      return false;
+    rewind();
+  }
+  if (pos >= length)
+    return stop();
+
+  uint8_t type = ANIM_BYTE(pos++);
+  changedFirst = changedCount = 0;
+  if (type == NEO_ANIM_RAW) {
+    if ((length - pos) < (uint32_t)numPixels * bpp)
+      return stop();
+    copyPixels(0, pos, numPixels);
+    changed(0, numPixels);
+    pos += (uint32_t)numPixels * bpp;
+  } else if (type == NEO_ANIM_DELTA) {
+    if ((length - pos) < 2)
+      return stop();
+    uint16_t spans = ANIM_WORD(pos);
+    pos += 2;
+    for (uint32_t n = 0; spans--;) {
+      if ((length - pos) < 3)
+        return stop();
+      n += ANIM_WORD(pos);
+      uint16_t count = ANIM_BYTE(pos + 2) + 1;
+      pos += 3;
+      if (((n + count) > numPixels) ||
+          ((length - pos) < (uint32_t)count * bpp))
+        return stop();
+      copyPixels(n, pos, count);
+      changed(n, count);
+      pos += (uint32_t)count * bpp;
+      n += count;
+    }
+  } else if (type == NEO_ANIM_RLE) {
+    for (uint16_t n = 0; n < numPixels;) {
+      if (pos >= length)
+        return stop();
+      uint8_t c = ANIM_BYTE(pos++);
+      uint16_t count = (c & 0x7F) + 1;
+      uint32_t bytes = (c & 0x80) ? bpp : (uint32_t)count * bpp;
+      if ((count > (numPixels - n)) || ((length - pos) < bytes))
+        return stop();
+      if (c & 0x80) {
+        fillPixels(n, pos, count);
+      } else {
+        copyPixels(n, pos, count);
+      }
+      pos += bytes;
+      n += count;
+    }
+    changed(0, numPixels);
+  } else if (type != NEO_ANIM_HOLD) {
+    return stop();
+  }
+
+  frame++;
+  return true;
+}
+
+/*!
+  @brief   Restart playback at the first frame. The next update() or
+           nextFrame() decodes frame 0.
+*/
+void Adafruit_NeoPixel_Player::rewind(void) {
+  pos = NEO_ANIM_HEADER_SIZE;
+  frame = 0;
+}
+
+/*!
+  @brief   Copy pixels from the animation data into the strip, converting
+           color order and applying brightness as needed.
+  @param   first  Index of first pixel.
+  @param   src    Offset of first pixel within animation data.
+  @param   count  Number of pixels.
+*/
+void Adafruit_NeoPixel_Player::copyPixels(uint16_t first, uint32_t src,
+                                          uint16_t count) {
+  uint16_t n = strip.numPixels();
+  if (first >= n)
+    return;
+  if (count > (n - first))
+    count = n - first; // Clip to strip length
+
+  uint8_t stripOrder = strip.getOrder(), stripBpp = strip.bytesPerPixel();
+  uint8_t *p = &strip.getPixels()[first * stripBpp];
+  const uint16_t *s = strip.getScale();
+
+  if ((order == stripOrder) && !s) {
+    // Same layout, no scaling: straight copy
+    memcpy_P(p, data + src, (uint32_t)count * bpp);
+    return;
+  }
+
+  uint8_t rOff = (order >> 4) & 3, gOff = (order >> 2) & 3, bOff = order & 3,
+          wOff = (order >> 6) & 3;
+  uint8_t rOffset = (stripOrder >> 4) & 3, gOffset = (stripOrder >> 2) & 3,
+          bOffset = stripOrder & 3, wOffset = (stripOrder >> 6) & 3;
+  for (; count--; src += bpp, p += stripBpp) {
+    uint8_t r = ANIM_BYTE(src + rOff), g = ANIM_BYTE(src + gOff),
+            bl = ANIM_BYTE(src + bOff),
+            w = (bpp == 4) ? ANIM_BYTE(src + wOff) : 0;
+    if (s) { // See notes in setBrightness()
+      r = (r * s[0]) >> 8;
+      g = (g * s[1]) >> 8;
+      bl = (bl * s[2]) >> 8;
+      w = (w * s[3]) >> 8;
+    }
+    p[rOffset] = r;
+    p[gOffset] = g;
+    p[bOffset] = bl;
+    if (stripBpp == 4)
+      p[wOffset] = w;
+  }
+}
+
+/*!
+  @brief   Set a run of strip pixels to a single pixel from the animation
+           data, converting color order and applying brightness as needed.
+  @param   first  Index of first pixel.
+  @param   src    Offset of pixel within animation data.
+  @param   count  Number of pixels.
+*/
+void Adafruit_NeoPixel_Player::fillPixels(uint16_t first, uint32_t src,
+                                          uint16_t count) {
+  uint16_t n = strip.numPixels();
+  if (first >= n)
+    return;
+  if (count > (n - first))
+    count = n - first;
+
+  // Convert the pixel once, then replicate it
+  copyPixels(first, src, 1);
+  uint8_t stripBpp = strip.bytesPerPixel();
+  uint8_t *p = &strip.getPixels()[first * stripBpp];
+  for (uint32_t i = stripBpp; i < (uint32_t)count * stripBpp; i++)
+    p[i] = p[i - stripBpp];
+}
+
+/*!
+  @brief   Extend the changed range of the current frame, clipped to the
+           strip's length.
+  @param   first  Index of first changed pixel.
+  @param   count  Number of changed pixels.
+*/
+void Adafruit_NeoPixel_Player::changed(uint16_t first, uint16_t count) {
+  uint16_t n = strip.numPixels();
+  if (first >= n)
+    return;
+  uint16_t end = (count > (n - first)) ? n : first + count;
+  if (changedCount) {
+    uint16_t oldEnd = changedFirst + changedCount;
+    if (changedFirst < first)
+      first = changedFirst;
+    if (oldEnd > end)
+      end = oldEnd;
+  }
+  changedFirst = first;
+  changedCount = end - first;
+}
+
+/*!
+  @brief   Make a NEO_ANIM_DELTA frame (including its frame type byte)
+           from two consecutive frames of pixel data. Portable code with
+           no hardware dependencies, so it may also be built into desktop
+           tools that convert animations.
+  @param   prev           Prior frame's pixel data.
+  @param   next           Next frame's pixel data.
+  @param   numPixels      Number of pixels in each frame.
+  @param   bytesPerPixel  3 for RGB color orders, 4 for RGBW.
+  @param   out            Buffer to receive the encoded frame.
+  @param   outSize        Size of out in bytes.
+  @return  Size of the encoded frame in bytes, or 0 if it doesn't fit in
+           outSize (a keyframe may be more compact then anyway).
+  @note    Unchanged runs of pixels shorter than a span's 3-byte overhead
+           are folded into the surrounding span rather than starting a
+           new one.
+*/
+uint32_t Adafruit_NeoPixel_Player::encodeDelta(const uint8_t *prev,
+                                               const uint8_t *next,
+                                               uint16_t numPixels,
+                                               uint8_t bytesPerPixel,
+                                               uint8_t *out,
+                                               uint32_t outSize) {
+  if (outSize < 3)
+    return 0;
+  uint32_t len = 3;     // Frame type and span count are filled in last
+  uint16_t spans = 0;
+  uint32_t last = 0;    // End of prior span
+  uint32_t i = 0;
+  // Gap of unchanged pixels worth splitting a span for
+  uint8_t minGap = 3 / bytesPerPixel + 1;
+
+  while (i < numPixels) {
+    // Skip unchanged pixels
+    while ((i < numPixels) && !memcmp(&prev[i * bytesPerPixel],
+                                      &next[i * bytesPerPixel],
+                                      bytesPerPixel))
+      i++;
+    if (i >= numPixels)
+      break;
+    // Extend span until minGap unchanged pixels, end of strip, or 256
+    uint32_t start = i, end = i + 1, gap = 0;
+    for (i++; (i < numPixels) && ((i - start) < 256) && (gap < minGap);
+         i++) {
+      if (memcmp(&prev[i * bytesPerPixel], &next[i * bytesPerPixel],
+                 bytesPerPixel)) {
+        end = i + 1;
+        gap = 0;
+      } else {
+        gap++;
+      }
+    }
+    i = end;
+    uint32_t count = end - start, bytes = 3 + count * bytesPerPixel;
+    if ((outSize - len) < bytes)
+      return 0;
+    out[len++] = (start - last) & 0xFF;
+    out[len++] = (start - last) >> 8;
+    out[len++] = count - 1;
+    memcpy(&out[len], &next[start * bytesPerPixel], count * bytesPerPixel);
+    len += count * bytesPerPixel;
+    last = end;
+    spans++;
+  }
+
+  out[0] = NEO_ANIM_DELTA;
+  out[1] = spans & 0xFF;
+  out[2] = spans >> 8;
+  return len;
+}
+
+/*!
+  @brief   Stop playback following malformed data.
+  @return  false, for convenience in returning from callers.
+*/
+bool Adafruit_NeoPixel_Player::stop(void) {
+  data = NULL;
+  return false;
+}
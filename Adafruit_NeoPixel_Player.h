@@ -0,0 +1,155 @@
+/*!
+ * @file Adafruit_NeoPixel_Player.h
+ *
+ * Playback of precomputed NeoPixel animations stored in flash (PROGMEM
+ * on AVR, or any memory-mapped array elsewhere), decoding each frame
+ * straight into an Adafruit_NeoPixel strip's pixel buffer.
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADAFRUIT_NEOPIXEL_PLAYER_H
+#define ADAFRUIT_NEOPIXEL_PLAYER_H
+
+#include "Adafruit_NeoPixel.h"
+
+// Animation data layout. All multi-byte values are little-endian.
+//
+// 12-byte header:
+//   0  'N','P','X','A'  Signature
+//   4  uint16           Number of pixels per frame
+//   6  uint8            Color order of the pixel data, same values as the
+//                       Adafruit_NeoPixel constructor (NEO_GRB, NEO_RGBW,
+//                       etc.). RGBW orders have 4 bytes per pixel, others 3.
+//   7  uint8            Frames per second, 1-255
+//   8  uint16           Number of frames
+//   10 uint16           Reserved, 0
+//
+// Then each frame in turn, as a one-byte frame type and its data:
+//   NEO_ANIM_RAW   Every pixel, uncompressed.
+//   NEO_ANIM_RLE   Run-length packets until all pixels are covered. Each
+//                  packet is a count byte, n: if bit 7 is set, one pixel
+//                  follows, repeated (n & 0x7F) + 1 times; otherwise
+//                  n + 1 literal pixels follow.
+//   NEO_ANIM_HOLD  No data, pixels are unchanged from the prior frame.
+//   NEO_ANIM_DELTA Only the pixels changed from the prior frame: a uint16
+//                  span count, then for each span a uint16 number of
+//                  unchanged pixels to skip (from the end of the prior
+//                  span, or the start of the strip), a uint8 pixel count
+//                  minus 1, and that many literal pixels. Decoded in place
+//                  over the prior frame, so the first frame can't be a
+//                  delta, and anything drawn over the strip between frames
+//                  persists where the delta doesn't overwrite it.
+//                  Adafruit_NeoPixel_Player::encodeDelta() makes these.
+//
+// The player doesn't require the file to match the strip: pixels beyond
+// the strip's length are skipped, and color order and white channel are
+// converted if needed. Data matching the strip's color order, played at
+// full brightness (no setBrightness() or setColorCorrection()), decodes
+// fastest.
+
+#define NEO_ANIM_RAW 0  ///< Frame type: uncompressed pixels
+#define NEO_ANIM_RLE 1  ///< Frame type: run-length encoded pixels
+#define NEO_ANIM_HOLD 2 ///< Frame type: no change from prior frame
+#define NEO_ANIM_DELTA 3 ///< Frame type: changed spans from prior frame
+
+#define NEO_ANIM_HEADER_SIZE 12 ///< Size of animation header in bytes
+
+/*!
+    @brief  Class that plays animations in the format described above
+            on an Adafruit_NeoPixel strip.
+*/
+class Adafruit_NeoPixel_Player {
+
+public:
+  Adafruit_NeoPixel_Player(Adafruit_NeoPixel &strip);
+
+  bool begin(const uint8_t *data, uint32_t length);
+  bool update(void);
+  bool nextFrame(void);
+  void rewind(void);
+  /*!
+    @brief   Set whether playback restarts after the last frame.
+    @param   loop  true to repeat (the default), false to stop.
+  */
+  void setLoop(bool loop) { looping = loop; }
+  /*!
+    @brief   Query the number of frames in the animation.
+    @return  Frame count, 0 if no valid animation.
+  */
+  uint16_t getFrameCount(void) const { return frames; }
+  /*!
+    @brief   Query the index of the next frame to be decoded.
+    @return  Frame index, 0 to getFrameCount().
+  */
+  uint16_t getFrame(void) const { return frame; }
+  /*!
+    @brief   Query the animation's frame rate.
+    @return  Frames per second, 0 if no valid animation.
+  */
+  uint8_t getFPS(void) const { return fps; }
+  /*!
+    @brief   Check whether playback has finished (last frame decoded with
+             looping off) or stopped on malformed data. rewind() restarts
+             the former; the latter needs a new begin().
+    @return  true if there are no further frames to play.
+  */
+  bool done(void) const { return !data || (!looping && (frame >= frames)); }
+  /*!
+    @brief   Query the first pixel changed by the most recent frame, for
+             passing to Adafruit_NeoPixel::updateFrame() along with
+             getChangedCount().
+    @return  Pixel index, starting from 0.
+  */
+  uint16_t getChangedFirst(void) const { return changedFirst; }
+  /*!
+    @brief   Query the number of pixels (from getChangedFirst()) that the
+             most recent frame may have changed. Pixels within the range
+             may have been rewritten with their prior value.
+    @return  Pixel count, 0 if the frame changed nothing.
+  */
+  uint16_t getChangedCount(void) const { return changedCount; }
+
+  static uint32_t encodeDelta(const uint8_t *prev, const uint8_t *next,
+                              uint16_t numPixels, uint8_t bytesPerPixel,
+                              uint8_t *out, uint32_t outSize);
+
+private:
+  void copyPixels(uint16_t first, uint32_t src, uint16_t count);
+  void fillPixels(uint16_t first, uint32_t src, uint16_t count);
+  void changed(uint16_t first, uint16_t count);
+  bool stop(void);
+
+  Adafruit_NeoPixel &strip; ///< Strip receiving the decoded frames
+  const uint8_t *data;      ///< Animation data, NULL if stopped
+  uint32_t length;          ///< Size of animation data in bytes
+  uint32_t pos;             ///< Decode position within data
+  uint32_t nextTime;        ///< micros() when next frame is due
+  uint16_t numPixels;       ///< Pixels per frame
+  uint16_t frames;          ///< Number of frames
+  uint16_t frame;           ///< Next frame to decode
+  uint16_t changedFirst;    ///< First pixel changed by last frame
+  uint16_t changedCount;    ///< Number of pixels changed by last frame
+  uint8_t order;            ///< Color order of pixel data
+  uint8_t bpp;              ///< Bytes per pixel, 3 or 4
+  uint8_t fps;              ///< Frames per second
+  bool looping;             ///< true if restarting after last frame
+  bool timed;               ///< true if nextTime is valid
+};
+
+#endif // ADAFRUIT_NEOPIXEL_PLAYER_H
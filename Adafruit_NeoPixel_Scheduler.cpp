@@ -0,0 +1,157 @@
+/*!
+ * @file Adafruit_NeoPixel_Scheduler.cpp
+ *
+ * @section intro_sec Introduction
+ *
+ * Non-blocking effect scheduler for the Adafruit_NeoPixel library.
+ *
+ * @section license License
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "Adafruit_NeoPixel_Scheduler.h"
+
+/*!
+  @brief   Scheduler constructor. Add effects with add().
+*/
+Adafruit_NeoPixel_Scheduler::Adafruit_NeoPixel_Scheduler(void)
+    : numEntries(0) {}
+
+/*!
+  @brief   Add an effect to the scheduler. Its first frame is drawn on the
+           next run().
+  @param   effect  Effect to run. Must outlive the scheduler.
+  @param   strip   Adafruit_NeoPixel object the effect draws into, already
+                   begun. Must outlive the scheduler.
+  @param   fps     Frames per second to update the effect at, 1 or more.
+  @return  true on success, false if the scheduler already has
+           NEO_SCHEDULER_MAX_EFFECTS effects.
+*/
+bool Adafruit_NeoPixel_Scheduler::add(Adafruit_NeoPixel_Effect &effect,
+                                      Adafruit_NeoPixel &strip,
+                                      uint16_t fps) {
+  if (numEntries >= NEO_SCHEDULER_MAX_EFFECTS)
+    return false;
+  Entry &e = entries[numEntries];
+  memset(&e, 0, sizeof e);
+  e.effect = &effect;
+  e.strip = &strip;
+  e.enabled = true;
+  e.due = micros();
+  setFPS(numEntries++, fps);
+  return true;
+}
+
+/*!
+  @brief   Add an effect that draws into Adafruit_NeoPixel_Segment zones
+           of a chain. The chain's strip is shown as for any other effect,
+           and the chain's changed range is reset each time it is.
+  @param   effect  Effect to run. Must outlive the scheduler.
+  @param   chain   Adafruit_NeoPixel_Chain of the segments the effect
+                   draws into, its strip already begun. Must outlive the
+                   scheduler.
+  @param   fps     Frames per second to update the effect at, 1 or more.
+  @return  true on success, false if the scheduler already has
+           NEO_SCHEDULER_MAX_EFFECTS effects.
+*/
+bool Adafruit_NeoPixel_Scheduler::add(Adafruit_NeoPixel_Effect &effect,
+                                      Adafruit_NeoPixel_Chain &chain,
+                                      uint16_t fps) {
+  if (!add(effect, chain.getStrip(), fps))
+    return false;
+  entries[numEntries - 1].chain = &chain;
+  return true;
+}
+
+/*!
+  @brief   Change an effect's frame rate, from its next frame.
+  @param   i    Effect index, in the order added (0 = first).
+  @param   fps  Frames per second, 1 or more.
+*/
+void Adafruit_NeoPixel_Scheduler::setFPS(uint8_t i, uint16_t fps) {
+  if (i < numEntries)
+    entries[i].interval = 1000000UL / (fps ? fps : 1);
+}
+
+/*!
+  @brief   Pause or resume an effect. A paused effect isn't updated; its
+           pixels keep their last frame.
+  @param   i   Effect index, in the order added (0 = first).
+  @param   on  true to run the effect, false to pause it.
+*/
+void Adafruit_NeoPixel_Scheduler::setEnabled(uint8_t i, bool on) {
+  if ((i < numEntries) && (on != entries[i].enabled)) {
+    entries[i].enabled = on;
+    entries[i].due = micros(); // Resume at once, not after catching up
+  }
+}
+
+/*!
+  @brief   Call as often as possible from loop(). Updates each effect that
+           is due a frame, then shows each strip that an effect changed
+           and that can be shown without waiting.
+  @return  true if any strip was shown.
+*/
+bool Adafruit_NeoPixel_Scheduler::run(void) {
+  uint32_t now = millis();
+  for (uint8_t i = 0; i < numEntries; i++) {
+    Entry &e = entries[i];
+    uint32_t t = micros();
+    if (!e.enabled || ((int32_t)(t - e.due) < 0))
+      continue;
+    // Keep to the frame rate's schedule, unless more than a whole frame
+    // behind; then skip ahead rather than rushing out frames to catch up
+    e.due += e.interval;
+    if ((int32_t)(t - e.due) >= 0) {
+      e.stats.late += (t - e.due) / e.interval + 1;
+      e.due = t + e.interval;
+    }
+
+    bool changed = e.effect->update(now);
+    uint32_t elapsed = micros() - t;
+    if (e.stats.updates)
+      e.stats.render += ((int32_t)(elapsed - e.stats.render)) / 8;
+    else
+      e.stats.render = elapsed;
+    if (elapsed > e.stats.renderMax)
+      e.stats.renderMax = elapsed;
+    e.stats.updates++;
+    if (changed) {
+      e.stats.changed++;
+      e.dirty = true;
+    }
+  }
+
+  bool shown = false;
+  for (uint8_t i = 0; i < numEntries; i++) {
+    Adafruit_NeoPixel *strip = entries[i].strip;
+    if (!entries[i].dirty || !strip->canShow())
+      continue;
+    strip->show();
+    shown = true;
+    // This show covers every effect drawing into the same strip
+    for (uint8_t j = 0; j < numEntries; j++) {
+      if (entries[j].strip == strip) {
+        entries[j].dirty = false;
+        if (entries[j].chain)
+          entries[j].chain->clearDirty();
+      }
+    }
+  }
+  return shown;
+}
@@ -0,0 +1,123 @@
+/*!
+ * @file Adafruit_NeoPixel_Scheduler.h
+ *
+ * Non-blocking scheduler running several NeoPixel effects, each at its
+ * own frame rate.
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADAFRUIT_NEOPIXEL_SCHEDULER_H
+#define ADAFRUIT_NEOPIXEL_SCHEDULER_H
+
+#include "Adafruit_NeoPixel.h"
+#include "Adafruit_NeoPixel_Segment.h"
+
+#ifndef NEO_SCHEDULER_MAX_EFFECTS
+#define NEO_SCHEDULER_MAX_EFFECTS 8 ///< Max effects per scheduler
+#endif
+
+/*!
+    @brief  Base class for effects run by Adafruit_NeoPixel_Scheduler.
+            Subclasses implement update() to draw one frame.
+*/
+class Adafruit_NeoPixel_Effect {
+
+public:
+  virtual ~Adafruit_NeoPixel_Effect() {}
+  /*!
+    @brief   Draw the effect's next frame into its pixels. Called by the
+             scheduler at the effect's frame rate; must not call show() or
+             delay().
+    @param   now  millis() at the time of the call, for time-based
+                  animation.
+    @return  true if any pixels changed, false if the frame is the same as
+             the last (so the strip needn't be shown on its account).
+  */
+  virtual bool update(uint32_t now) = 0;
+};
+
+/*!
+    @brief  Timing statistics kept by Adafruit_NeoPixel_Scheduler for each
+            effect. All times are in microseconds.
+*/
+typedef struct {
+  uint32_t updates;    ///< Number of update() calls
+  uint32_t changed;    ///< Number of those that changed pixels
+  uint32_t late;       ///< Frames skipped because the loop fell behind
+  uint32_t render;     ///< Average time in update()
+  uint32_t renderMax;  ///< Longest single update()
+} neoEffectStats;
+
+/*!
+    @brief  Class that runs a set of effects, each at its own frame rate,
+            from loop() without delay(). Any number of effects may draw
+            into the same strip (e.g. into separate
+            Adafruit_NeoPixel_Segment zones); each strip is shown at most
+            once per run(), and only if an effect changed it. A strip
+            still within its data latch interval (see canShow()) isn't
+            waited for; it's shown on a later run() instead, so one slow
+            strip doesn't hold up the others. Effects drawing through
+            segments should be added with their Adafruit_NeoPixel_Chain,
+            so the chain's changed range is reset each time the strip is
+            shown.
+*/
+class Adafruit_NeoPixel_Scheduler {
+
+public:
+  Adafruit_NeoPixel_Scheduler(void);
+
+  bool add(Adafruit_NeoPixel_Effect &effect, Adafruit_NeoPixel &strip,
+           uint16_t fps);
+  bool add(Adafruit_NeoPixel_Effect &effect, Adafruit_NeoPixel_Chain &chain,
+           uint16_t fps);
+  bool run(void);
+  void setFPS(uint8_t i, uint16_t fps);
+  void setEnabled(uint8_t i, bool on);
+  /*!
+    @brief   Retrieve timing statistics for an effect.
+    @param   i  Effect index, in the order added (0 = first).
+    @return  Reference to the effect's neoEffectStats structure.
+  */
+  const neoEffectStats &getStats(uint8_t i) const { return entries[i].stats; }
+  /*!
+    @brief   Return the number of effects added.
+    @return  Effect count.
+  */
+  uint8_t numEffects(void) const { return numEntries; }
+
+private:
+  /*!
+      @brief  An effect, the strip it draws into, and its schedule.
+  */
+  struct Entry {
+    Adafruit_NeoPixel_Effect *effect; ///< Effect to update
+    Adafruit_NeoPixel *strip;         ///< Strip effect draws into
+    Adafruit_NeoPixel_Chain *chain;   ///< Chain to reset on show, or NULL
+    uint32_t interval;                ///< Microseconds between frames
+    uint32_t due;                     ///< micros() when next frame is due
+    neoEffectStats stats;             ///< Timing statistics
+    bool enabled;                     ///< false if paused
+    bool dirty;                       ///< true if strip awaits show()
+  };
+
+  Entry entries[NEO_SCHEDULER_MAX_EFFECTS]; ///< Effects, in order added
+  uint8_t numEntries;                       ///< Number of entries
+};
+
+#endif // ADAFRUIT_NEOPIXEL_SCHEDULER_H
@@ -0,0 +1,177 @@
+/*!
+ * @file Adafruit_NeoPixel_Segment.cpp
+ *
+ * @section intro_sec Introduction
+ *
+ * Strip segments for the Adafruit_NeoPixel library.
+ *
+ * @section license License
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "Adafruit_NeoPixel_Segment.h"
+
+/*!
+  @brief   Chain constructor.
+  @param   strip  Adafruit_NeoPixel object to track. Must outlive the
+                  chain.
+*/
+Adafruit_NeoPixel_Chain::Adafruit_NeoPixel_Chain(Adafruit_NeoPixel &strip)
+    : strip(strip), dirtyFirst(0), dirtyEnd(0) {}
+
+/*!
+  @brief   Show the strip if any pixels changed since the last show(), and
+           reset the changed range.
+  @return  true if the strip was shown, false if nothing had changed.
+*/
+bool Adafruit_NeoPixel_Chain::show(void) {
+  if (!isDirty())
+    return false;
+  strip.show();
+  dirtyFirst = dirtyEnd = 0;
+  return true;
+}
+
+/*!
+  @brief   Add a run of strip pixels to the changed range. Segments call
+           this as they draw; call it directly after writing to the strip
+           by other means.
+  @param   first  Strip index of first pixel changed.
+  @param   count  Number of pixels changed.
+*/
+void Adafruit_NeoPixel_Chain::markDirty(uint16_t first, uint16_t count) {
+  if (!count)
+    return;
+  uint16_t end = first + count;
+  if (!isDirty()) {
+    dirtyFirst = first;
+    dirtyEnd = end;
+  } else {
+    if (first < dirtyFirst)
+      dirtyFirst = first;
+    if (end > dirtyEnd)
+      dirtyEnd = end;
+  }
+}
+
+/*!
+  @brief   Segment constructor.
+  @param   chain     Chain of the physical strip. Must outlive the
+                     segment.
+  @param   first     Strip index of the segment's first pixel (its last
+                     pixel, if reversed).
+  @param   count     Number of pixels in segment. Clipped to the strip's
+                     length.
+  @param   reversed  true if segment pixel 0 is at the far end (highest
+                     strip index) of the segment. Default is false.
+*/
+Adafruit_NeoPixel_Segment::Adafruit_NeoPixel_Segment(
+    Adafruit_NeoPixel_Chain &chain, uint16_t first, uint16_t count,
+    bool reversed)
+    : chain(chain), first(first), count(count), reversed(reversed) {
+  uint16_t n = chain.getStrip().numPixels();
+  if (first >= n)
+    this->count = 0;
+  else if (count > (n - first))
+    this->count = n - first;
+}
+
+/*!
+  @brief   Set a segment pixel's color using separate red, green and blue
+           components.
+  @param   n  Pixel index within segment, starting from 0.
+  @param   r  Red brightness, 0 = minimum (off), 255 = maximum.
+  @param   g  Green brightness, 0 = minimum (off), 255 = maximum.
+  @param   b  Blue brightness, 0 = minimum (off), 255 = maximum.
+*/
+void Adafruit_NeoPixel_Segment::setPixelColor(uint16_t n, uint8_t r,
+                                              uint8_t g, uint8_t b) {
+  if (n < count) {
+    n = index(n);
+    chain.getStrip().setPixelColor(n, r, g, b);
+    chain.markDirty(n, 1);
+  }
+}
+
+/*!
+  @brief   Set a segment pixel's color using separate red, green, blue and
+           white components (for RGBW strips).
+  @param   n  Pixel index within segment, starting from 0.
+  @param   r  Red brightness, 0 = minimum (off), 255 = maximum.
+  @param   g  Green brightness, 0 = minimum (off), 255 = maximum.
+  @param   b  Blue brightness, 0 = minimum (off), 255 = maximum.
+  @param   w  White brightness, 0 = minimum (off), 255 = maximum, ignored
+              if the strip is RGB.
+*/
+void Adafruit_NeoPixel_Segment::setPixelColor(uint16_t n, uint8_t r,
+                                              uint8_t g, uint8_t b,
+                                              uint8_t w) {
+  if (n < count) {
+    n = index(n);
+    chain.getStrip().setPixelColor(n, r, g, b, w);
+    chain.markDirty(n, 1);
+  }
+}
+
+/*!
+  @brief   Set a segment pixel's color using a 32-bit 'packed' RGB or RGBW
+           value.
+  @param   n  Pixel index within segment, starting from 0.
+  @param   c  32-bit color value, as from the strip's Color().
+*/
+void Adafruit_NeoPixel_Segment::setPixelColor(uint16_t n, uint32_t c) {
+  if (n < count) {
+    n = index(n);
+    chain.getStrip().setPixelColor(n, c);
+    chain.markDirty(n, 1);
+  }
+}
+
+/*!
+  @brief   Fill all or part of the segment with a color.
+  @param   c      32-bit color value. If unspecified or 0, the segment is
+                  filled with 0 / black / off.
+  @param   first  Index of first pixel to fill, within segment, starting
+                  from 0. If unspecified, filling begins at the first
+                  pixel.
+  @param   count  Number of pixels to fill, as a positive value. Passing 0
+                  or leaving unspecified will fill to end of segment.
+*/
+void Adafruit_NeoPixel_Segment::fill(uint32_t c, uint16_t first,
+                                     uint16_t count) {
+  if (first >= this->count)
+    return;
+  if (!count || (count > (this->count - first)))
+    count = this->count - first;
+  // A run maps to a run of the strip either way; reversed, it's measured
+  // back from the segment's far end
+  uint16_t start = reversed ? this->first + this->count - first - count
+                            : this->first + first;
+  chain.getStrip().fill(c, start, count);
+  chain.markDirty(start, count);
+}
+
+/*!
+  @brief   Query the color of a segment pixel.
+  @param   n  Pixel index within segment, starting from 0.
+  @return  Pixel color as the strip's getPixelColor() returns it, or 0 if
+           n is out of range.
+*/
+uint32_t Adafruit_NeoPixel_Segment::getPixelColor(uint16_t n) const {
+  return (n < count) ? chain.getStrip().getPixelColor(index(n)) : 0;
+}
@@ -0,0 +1,130 @@
+/*!
+ * @file Adafruit_NeoPixel_Segment.h
+ *
+ * Logical segments (zones) of a physical NeoPixel strip, sharing the
+ * strip's pixel buffer.
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADAFRUIT_NEOPIXEL_SEGMENT_H
+#define ADAFRUIT_NEOPIXEL_SEGMENT_H
+
+#include "Adafruit_NeoPixel.h"
+
+/*!
+    @brief  Class that tracks which pixels of one physical strip have
+            changed since it was last shown, on behalf of the segments
+            drawing into it. Segments add the pixels they write to one
+            shared range, so a single show() covers all of them, and is
+            skipped if none changed.
+*/
+class Adafruit_NeoPixel_Chain {
+
+public:
+  Adafruit_NeoPixel_Chain(Adafruit_NeoPixel &strip);
+
+  bool show(void);
+  void markDirty(uint16_t first, uint16_t count);
+  /*!
+    @brief   Discard the changed range without showing, e.g. after showing
+             the strip by other means.
+  */
+  void clearDirty(void) { dirtyFirst = dirtyEnd = 0; }
+  /*!
+    @brief   Query whether any pixels changed since the last show().
+    @return  true if the strip needs showing.
+  */
+  bool isDirty(void) const { return dirtyEnd > dirtyFirst; }
+  /*!
+    @brief   Get the first strip pixel changed since the last show(), e.g.
+             for the strip's updateFrame().
+    @return  Pixel index. Meaningless if isDirty() is false.
+  */
+  uint16_t getDirtyFirst(void) const { return dirtyFirst; }
+  /*!
+    @brief   Get the number of strip pixels from getDirtyFirst() through
+             the last one changed since the last show(). Can be passed
+             as-is to the strip's updateFrame(), where 0 does nothing.
+    @return  Pixel count, 0 if none changed.
+  */
+  uint16_t getDirtyCount(void) const { return dirtyEnd - dirtyFirst; }
+  /*!
+    @brief   Get the physical strip.
+    @return  Adafruit_NeoPixel object passed to the constructor.
+  */
+  Adafruit_NeoPixel &getStrip(void) const { return strip; }
+
+private:
+  Adafruit_NeoPixel &strip; ///< Physical strip
+  uint16_t dirtyFirst;      ///< First changed pixel
+  uint16_t dirtyEnd;        ///< Pixel after last changed one
+};
+
+/*!
+    @brief  Class that presents a run of pixels within a physical strip as
+            a strip of its own, with the same drawing functions as
+            Adafruit_NeoPixel, optionally running backward. Segments are
+            only a few bytes; they write straight into the strip's pixel
+            buffer, and report what they change to the strip's
+            Adafruit_NeoPixel_Chain. Segments may overlap.
+*/
+class Adafruit_NeoPixel_Segment {
+
+public:
+  Adafruit_NeoPixel_Segment(Adafruit_NeoPixel_Chain &chain, uint16_t first,
+                            uint16_t count, bool reversed = false);
+
+  void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b);
+  void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b, uint8_t w);
+  void setPixelColor(uint16_t n, uint32_t c);
+  void fill(uint32_t c = 0, uint16_t first = 0, uint16_t count = 0);
+  uint32_t getPixelColor(uint16_t n) const;
+  /*!
+    @brief   Fill the whole segment with 0 / black / off.
+  */
+  void clear(void) { fill(0); }
+  /*!
+    @brief   Show the physical strip, if anything on it has changed. Same
+             as the chain's show(); with several segments on one strip,
+             calling this once per frame (for any segment) is enough.
+    @return  true if the strip was shown.
+  */
+  bool show(void) { return chain.show(); }
+  /*!
+    @brief   Convert a segment pixel index to the physical strip's.
+    @param   n  Pixel index within segment, starting from 0.
+    @return  Strip pixel index. Only valid if n < numPixels().
+  */
+  uint16_t index(uint16_t n) const {
+    return reversed ? first + count - 1 - n : first + n;
+  }
+  /*!
+    @brief   Return the number of pixels in the segment.
+    @return  Pixel count.
+  */
+  uint16_t numPixels(void) const { return count; }
+
+private:
+  Adafruit_NeoPixel_Chain &chain; ///< Chain of the strip drawn into
+  uint16_t first;                 ///< Strip index of segment's first end
+  uint16_t count;                 ///< Number of pixels
+  bool reversed;                  ///< true if pixel 0 is at strip's far end
+};
+
+#endif // ADAFRUIT_NEOPIXEL_SEGMENT_H
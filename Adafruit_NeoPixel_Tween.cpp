@@ -0,0 +1,258 @@
+/*!
+ * @file Adafruit_NeoPixel_Tween.cpp
+ *
+ * @section intro_sec Introduction
+ *
+ * Tween (timed transition) engine for the Adafruit_NeoPixel library.
+ *
+ * @section license License
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "Adafruit_NeoPixel_Tween.h"
+
+/*!
+  @brief   Tween constructor. Call begin() before use.
+  @param   strip  Adafruit_NeoPixel object, already begun. Must outlive
+                  the tween.
+*/
+Adafruit_NeoPixel_Tween::Adafruit_NeoPixel_Tween(Adafruit_NeoPixel &strip)
+    : strip(strip), from(NULL), to(NULL), startTime(0), duration(0),
+      first(0), count(0), bytes(0), lastWeight(0), easing(NEO_EASE_LINEAR),
+      running(false), started(false) {}
+
+/*!
+  @brief   Deallocate tween.
+*/
+Adafruit_NeoPixel_Tween::~Adafruit_NeoPixel_Tween() { free(from); }
+
+/*!
+  @brief   Allocate start and end buffers for a span of the strip, both
+           initially holding its current colors.
+  @param   first  Index of first pixel to transition. Default is 0.
+  @param   count  Number of pixels. Passing 0 or leaving unspecified
+                  covers the rest of the strip.
+  @return  true on success, false if there's insufficient RAM (2 bytes
+           per pixel color element) or the span is empty.
+*/
+bool Adafruit_NeoPixel_Tween::begin(uint16_t first, uint16_t count) {
+  free(from);
+  from = to = NULL;
+  running = false;
+  uint16_t n = strip.numPixels();
+  if (first >= n)
+    return false;
+  if (!count || (count > (n - first)))
+    count = n - first;
+  uint8_t bpp = strip.bytesPerPixel();
+  this->first = first;
+  this->count = count;
+  bytes = count * bpp;
+  if (!(from = (uint8_t *)malloc(bytes * 2)))
+    return false;
+  to = from + bytes;
+  capture(from);
+  capture(to);
+  return true;
+}
+
+/*!
+  @brief   Copy the span's current pixel data into a buffer.
+  @param   buf  Buffer, from or to.
+*/
+void Adafruit_NeoPixel_Tween::capture(uint8_t *buf) {
+  uint8_t bpp = strip.bytesPerPixel();
+  memcpy(buf, strip.getPixels() + (uint32_t)first * bpp, bytes);
+}
+
+/*!
+  @brief   Convert packed colors to strip byte order, brightness and color
+           correction, as setPixelColor() does.
+  @param   colors  count packed 32-bit RGB or WRGB colors.
+  @param   buf     Buffer, from or to.
+*/
+void Adafruit_NeoPixel_Tween::convert(const uint32_t *colors, uint8_t *buf) {
+  uint8_t order = strip.getOrder(), rOffset = (order >> 4) & 3,
+          gOffset = (order >> 2) & 3, bOffset = order & 3,
+          wOffset = order >> 6, bpp = strip.bytesPerPixel();
+  for (uint16_t i = 0; i < count; i++, buf += bpp) {
+    uint32_t c = colors[i];
+    uint8_t r = (uint8_t)(c >> 16), g = (uint8_t)(c >> 8), b = (uint8_t)c,
+            w = (uint8_t)(c >> 24);
+    strip.scaleColor(r, g, b, w);
+    buf[rOffset] = r;
+    buf[gOffset] = g;
+    buf[bOffset] = b;
+    if (bpp == 4)
+      buf[wOffset] = w;
+  }
+}
+
+/*!
+  @brief   Set the start colors to the span's current pixels, e.g. after
+           drawing the outgoing scene.
+*/
+void Adafruit_NeoPixel_Tween::captureFrom(void) {
+  if (from)
+    capture(from);
+}
+
+/*!
+  @brief   Set the end colors to the span's current pixels, e.g. after
+           drawing the incoming scene. (start() then returns the pixels
+           to the start colors on its first update().)
+*/
+void Adafruit_NeoPixel_Tween::captureTo(void) {
+  if (to)
+    capture(to);
+}
+
+/*!
+  @brief   Set the start colors from an array of packed colors.
+  @param   colors  One packed 32-bit RGB or WRGB color per pixel of the
+                   span, as from the strip's Color(). Brightness is
+                   applied as of this call.
+*/
+void Adafruit_NeoPixel_Tween::setFrom(const uint32_t *colors) {
+  if (from)
+    convert(colors, from);
+}
+
+/*!
+  @brief   Set the end colors from an array of packed colors.
+  @param   colors  One packed 32-bit RGB or WRGB color per pixel of the
+                   span, as from the strip's Color(). Brightness is
+                   applied as of this call.
+*/
+void Adafruit_NeoPixel_Tween::setTo(const uint32_t *colors) {
+  if (to)
+    convert(colors, to);
+}
+
+/*!
+  @brief   Start a transition from the start colors to the end colors.
+           Timing begins at the first update().
+  @param   duration  Length of transition in milliseconds.
+  @param   easing    Easing curve, one of the NEO_EASE_* values. Default
+                     is NEO_EASE_LINEAR.
+*/
+void Adafruit_NeoPixel_Tween::start(uint32_t duration, uint8_t easing) {
+  if (!from)
+    return;
+  this->duration = duration;
+  this->easing = easing;
+  running = true;
+  started = false;
+  lastWeight = 0xFFFF; // Force a first frame
+}
+
+/*!
+  @brief   Draw the transition's frame for a given time into the strip's
+           pixels. Call each frame, then show() the strip if it returns
+           true.
+  @param   now  Current time, as from millis().
+  @return  true if the pixels changed, false if the transition isn't
+           running or the frame is the same as the last.
+*/
+bool Adafruit_NeoPixel_Tween::update(uint32_t now) {
+  if (!running)
+    return false;
+  if (!started) {
+    startTime = now;
+    started = true;
+  }
+  uint32_t elapsed = now - startTime;
+  uint16_t weight;
+  if (elapsed >= duration) {
+    weight = 256;
+    running = false;
+  } else {
+    // Position along curve as 0.16 fixed point, eased, then rounded to
+    // an 8.8 blend weight (0-256)
+    // elapsed < duration, so t < 65536; 64-bit math only for long tweens
+    uint16_t t = (duration < 0x10000)
+                     ? (elapsed << 16) / duration
+                     : (uint16_t)(((uint64_t)elapsed << 16) / duration);
+    weight = ((uint32_t)ease(easing, t) + 128) >> 8;
+  }
+  if (weight == lastWeight)
+    return false;
+  lastWeight = weight;
+  blend(weight);
+  return true;
+}
+
+/*!
+  @brief   Blend start and end colors into the strip's pixels.
+  @param   weight  Share of end colors, 0 (all start) to 256 (all end).
+*/
+void Adafruit_NeoPixel_Tween::blend(uint16_t weight) {
+  uint8_t bpp = strip.bytesPerPixel();
+  uint8_t *out = strip.getPixels() + (uint32_t)first * bpp;
+  const uint8_t *a = from, *b = to;
+  uint32_t wa = 256 - weight, wb = weight;
+  uint16_t i = 0;
+#if !defined(__AVR__)
+  // Four bytes at a time as two pairs of 16-bit lanes. Each lane's
+  // a*(256-w)+b*w is at most 255*256, so it can't spill into the next.
+  // memcpy() keeps this safe for unaligned spans and compiles to plain
+  // 32-bit loads and stores where the CPU allows. Not on AVR, where
+  // 32-bit multiplies make this slower than the byte loop.
+  for (; (i + 4) <= bytes; i += 4) {
+    uint32_t x, y;
+    memcpy(&x, a + i, 4);
+    memcpy(&y, b + i, 4);
+    uint32_t even = (((x & 0x00FF00FF) * wa + (y & 0x00FF00FF) * wb) >> 8) &
+                    0x00FF00FF;
+    uint32_t odd = (((x >> 8) & 0x00FF00FF) * wa +
+                    ((y >> 8) & 0x00FF00FF) * wb) &
+                   0xFF00FF00;
+    x = even | odd;
+    memcpy(out + i, &x, 4);
+  }
+#endif
+  for (; i < bytes; i++)
+    out[i] = (a[i] * wa + b[i] * wb) >> 8;
+}
+
+/*!
+  @brief   Apply an easing curve to a position, in fixed point.
+  @param   easing  Easing curve, one of the NEO_EASE_* values.
+  @param   t       Position in time, 0 (start) to 65535 (end).
+  @return  Position along the transition, 0 (start) to 65535 (end).
+*/
+uint16_t Adafruit_NeoPixel_Tween::ease(uint8_t easing, uint16_t t) {
+  uint32_t p = t, q = 65535 - t;
+  switch (easing) {
+  case NEO_EASE_IN_QUAD:
+    return (p * p) >> 16;
+  case NEO_EASE_OUT_QUAD:
+    return 65535 - ((q * q + 65535) >> 16); // Round up so 0 maps to 0
+  case NEO_EASE_INOUT_QUAD:
+    return (p < 32768) ? (p * p) >> 15 : 65535 - ((q * q) >> 15);
+  case NEO_EASE_IN_CUBIC:
+    return (((p * p) >> 16) * p) >> 16;
+  case NEO_EASE_OUT_CUBIC:
+    return 65535 - ((((q * q + 65535) >> 16) * q + 65535) >> 16);
+  case NEO_EASE_INOUT_CUBIC:
+    return (p < 32768) ? (((p * p) >> 16) * p) >> 14
+                       : 65535 - ((((q * q) >> 16) * q) >> 14);
+  default: // NEO_EASE_LINEAR
+    return t;
+  }
+}
@@ -0,0 +1,93 @@
+/*!
+ * @file Adafruit_NeoPixel_Tween.h
+ *
+ * Timed, eased transitions between two sets of NeoPixel colors.
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADAFRUIT_NEOPIXEL_TWEEN_H
+#define ADAFRUIT_NEOPIXEL_TWEEN_H
+
+#include "Adafruit_NeoPixel.h"
+#include "Adafruit_NeoPixel_Scheduler.h"
+
+// Easing curves for start()
+#define NEO_EASE_LINEAR 0       ///< Constant rate
+#define NEO_EASE_IN_QUAD 1      ///< Start slow, quadratic
+#define NEO_EASE_OUT_QUAD 2     ///< End slow, quadratic
+#define NEO_EASE_INOUT_QUAD 3   ///< Start and end slow, quadratic
+#define NEO_EASE_IN_CUBIC 4     ///< Start slow, cubic
+#define NEO_EASE_OUT_CUBIC 5    ///< End slow, cubic
+#define NEO_EASE_INOUT_CUBIC 6  ///< Start and end slow, cubic
+
+/*!
+    @brief  Class that fades a run of a strip's pixels from one set of
+            colors to another over a set time, following an easing curve.
+
+            Both ends are kept in the strip's native byte order, with
+            brightness already applied, so each frame is only a blend of
+            two byte arrays straight into the strip's pixel buffer: time
+            is converted to a 0.16 fixed-point position along the
+            curve, then to an 8.8 blend weight, and bytes are blended two
+            at a time in each 32-bit word (16 bits per byte, so no
+            carries cross between them).
+
+            It's an Adafruit_NeoPixel_Effect, so it can be run by an
+            Adafruit_NeoPixel_Scheduler, or by calling update() directly.
+*/
+class Adafruit_NeoPixel_Tween : public Adafruit_NeoPixel_Effect {
+
+public:
+  Adafruit_NeoPixel_Tween(Adafruit_NeoPixel &strip);
+  ~Adafruit_NeoPixel_Tween();
+
+  bool begin(uint16_t first = 0, uint16_t count = 0);
+  void captureFrom(void);
+  void captureTo(void);
+  void setFrom(const uint32_t *colors);
+  void setTo(const uint32_t *colors);
+  void start(uint32_t duration, uint8_t easing = NEO_EASE_LINEAR);
+  bool update(uint32_t now);
+  static uint16_t ease(uint8_t easing, uint16_t t);
+  /*!
+    @brief   Query whether a transition is in progress.
+    @return  true if started and not yet at its end.
+  */
+  bool isRunning(void) const { return running; }
+
+private:
+  void capture(uint8_t *buf);
+  void convert(const uint32_t *colors, uint8_t *buf);
+  void blend(uint16_t weight);
+
+  Adafruit_NeoPixel &strip; ///< Strip being drawn into
+  uint8_t *from;            ///< Start colors, strip byte order
+  uint8_t *to;              ///< End colors, strip byte order
+  uint32_t startTime;       ///< millis() at first update() after start()
+  uint32_t duration;        ///< Length of transition in ms
+  uint16_t first;           ///< First pixel of span
+  uint16_t count;           ///< Number of pixels in span
+  uint16_t bytes;           ///< Bytes in span
+  uint16_t lastWeight;      ///< Blend weight of last frame drawn
+  uint8_t easing;           ///< NEO_EASE_* curve
+  bool running;             ///< true if transition in progress
+  bool started;             ///< true once startTime is set
+};
+
+#endif // ADAFRUIT_NEOPIXEL_TWEEN_H
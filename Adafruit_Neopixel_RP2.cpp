@@ -16,14 +16,11 @@ bool Adafruit_NeoPixel::rp2040claimPIO(void) {
   }
 
   // yay ok!
-  
-  if (is800KHz) {
-    // 800kHz, 8 bit transfers
-    ws2812_program_init(pio, pio_sm, pio_program_offset, pin, 800000, 8);
-  } else {
-    // 400kHz, 8 bit transfers
-    ws2812_program_init(pio, pio_sm, pio_program_offset, pin, 400000, 8);
-  }
+
+  // Bit rate from the strip's timing (800kHz, 400kHz or per setChip()),
+  // 8 bit transfers
+  ws2812_program_init(pio, pio_sm, pio_program_offset, pin,
+                      1000000000.0 / bitTiming().period, 8);
 
   return true;
 }
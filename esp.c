@@ -35,7 +35,65 @@
 
 static SemaphoreHandle_t show_mutex = NULL;
 
-void espShow(uint8_t pin, uint8_t *pixels, uint32_t numBytes, boolean is800KHz) {
+// RMT runs at 10 MHz (100 ns per tick) here
+#define RMT_NS_TO_TICKS(ns) ((ns) / 100)
+
+#define SEMAPHORE_TIMEOUT_MS 50
+
+// Pin the RMT channel is currently initialized on, shared between all
+// instances
+static int rmtPin = -1;
+
+// (Re)initialize the RMT channel on pin if it isn't already there.
+// Call with show_mutex held.
+static bool espClaimPin(uint8_t pin) {
+  if (pin != rmtPin) {
+    if (rmtPin >= 0) {
+      rmtDeinit(rmtPin);
+      rmtPin = -1;
+    }
+    if (!rmtInit(pin, RMT_TX_MODE, RMT_MEM_NUM_BLOCKS_1, 10000000)) {
+      log_e("Failed to init RMT TX mode on pin %d", pin);
+      return false;
+    }
+    rmtPin = pin;
+  }
+  return true;
+}
+
+// Convert pixel data to RMT symbols, one per bit. symbols must have room
+// for numBytes * 8 rmt_data_t. Bit timing (t0h, t1h, period) is in
+// nanoseconds, see neoPixelTiming.
+void espEncode(uint8_t *pixels, uint32_t numBytes, uint16_t t0h,
+               uint16_t t1h, uint16_t period, void *symbols) {
+  rmt_data_t *led_data = (rmt_data_t *)symbols;
+  // Low times are taken from the whole period so that truncation
+  // of the high time doesn't also shorten the bit
+  uint16_t t0hTicks = RMT_NS_TO_TICKS(t0h),
+           t0lTicks = RMT_NS_TO_TICKS(period) - t0hTicks,
+           t1hTicks = RMT_NS_TO_TICKS(t1h),
+           t1lTicks = RMT_NS_TO_TICKS(period) - t1hTicks;
+  int i=0;
+  for (int b=0; b < numBytes; b++) {
+    for (int bit=0; bit<8; bit++){
+      if ( pixels[b] & (1<<(7-bit)) ) {
+        led_data[i].level0 = 1;
+        led_data[i].duration0 = t1hTicks;
+        led_data[i].level1 = 0;
+        led_data[i].duration1 = t1lTicks;
+      } else {
+        led_data[i].level0 = 1;
+        led_data[i].duration0 = t0hTicks;
+        led_data[i].level1 = 0;
+        led_data[i].duration1 = t0lTicks;
+      }
+      i++;
+    }
+  }
+}
+
+void espShow(uint8_t pin, uint8_t *pixels, uint32_t numBytes,
+             uint16_t t0h, uint16_t t1h, uint16_t period) {
   // Note: Because rmtPin is shared between all instances, we will
   //  end up releasing/initializing the RMT channels each time we
   //  invoke on different pins. This is probably ok, just not
@@ -43,11 +101,8 @@ void espShow(uint8_t pin, uint8_t *pixels, uint32_t numBytes, boolean is800KHz)
   //  be allocated with enough space for the largest instance; data
   //  is not used beyond the mutex lock so this should be fine.
 
-#define SEMAPHORE_TIMEOUT_MS 50
-
   static rmt_data_t *led_data = NULL;
   static uint32_t led_data_size = 0;
-  static int rmtPin = -1;
 
   if (show_mutex && xSemaphoreTake(show_mutex, SEMAPHORE_TIMEOUT_MS / portTICK_PERIOD_MS) == pdTRUE) {
     uint32_t requiredSize = numBytes * 8;
@@ -73,37 +128,8 @@ void espShow(uint8_t pin, uint8_t *pixels, uint32_t numBytes, boolean is800KHz)
     }
 
     if (led_data_size > 0 && requiredSize <= led_data_size) {
-      if (pin != rmtPin) {
-        if (rmtPin >= 0) {
-          rmtDeinit(rmtPin);
-          rmtPin = -1;
-        }
-        if (!rmtInit(pin, RMT_TX_MODE, RMT_MEM_NUM_BLOCKS_1, 10000000)) {
-          log_e("Failed to init RMT TX mode on pin %d", pin);
-          return;
-        }
-        rmtPin = pin;
-      }
-
-      if (rmtPin >= 0) {
-        int i=0;
-        for (int b=0; b < numBytes; b++) {
-          for (int bit=0; bit<8; bit++){
-            if ( pixels[b] & (1<<(7-bit)) ) {
-              led_data[i].level0 = 1;
-              led_data[i].duration0 = 8;
-              led_data[i].level1 = 0;
-              led_data[i].duration1 = 4;
-            } else {
-              led_data[i].level0 = 1;
-              led_data[i].duration0 = 4;
-              led_data[i].level1 = 0;
-              led_data[i].duration1 = 8;
-            }
-            i++;
-          }
-        }
-
+      if (espClaimPin(pin)) {
+        espEncode(pixels, numBytes, t0h, t1h, period, led_data);
         rmtWrite(pin, led_data, numBytes * 8, RMT_WAIT_FOR_EVER);
       }
     }
@@ -112,6 +138,16 @@ void espShow(uint8_t pin, uint8_t *pixels, uint32_t numBytes, boolean is800KHz)
   }
 }
 
+// Issue symbols previously produced by espEncode()
+void espShowEncoded(uint8_t pin, void *symbols, uint32_t numSymbols) {
+  if (show_mutex && xSemaphoreTake(show_mutex, SEMAPHORE_TIMEOUT_MS / portTICK_PERIOD_MS) == pdTRUE) {
+    if (numSymbols && espClaimPin(pin)) {
+      rmtWrite(pin, (rmt_data_t *)symbols, numSymbols, RMT_WAIT_FOR_EVER);
+    }
+    xSemaphoreGive(show_mutex);
+  }
+}
+
 // To avoid race condition initializing the mutex, all instances of
 //  Adafruit_NeoPixel must be constructed before launching and child threads
 void espInit() {
@@ -128,16 +164,6 @@ void espInit() {
 // This code is adapted from the ESP-IDF v3.4 RMT "led_strip" example, altered
 // to work with the Arduino version of the ESP-IDF (3.2)
 
-#define WS2812_T0H_NS (400)
-#define WS2812_T0L_NS (850)
-#define WS2812_T1H_NS (800)
-#define WS2812_T1L_NS (450)
-
-#define WS2811_T0H_NS (500)
-#define WS2811_T0L_NS (2000)
-#define WS2811_T1H_NS (1200)
-#define WS2811_T1L_NS (1300)
-
 static uint32_t t0h_ticks = 0;
 static uint32_t t1h_ticks = 0;
 static uint32_t t0l_ticks = 0;
@@ -185,7 +211,9 @@ static void IRAM_ATTR ws2812_rmt_adapter(const void *src, rmt_item32_t *dest, si
     *item_num = num;
 }
 
-void espShow(uint8_t pin, uint8_t *pixels, uint32_t numBytes, boolean is800KHz) {
+// Bit timing (t0h, t1h, period) is in nanoseconds, see neoPixelTiming.
+void espShow(uint8_t pin, uint8_t *pixels, uint32_t numBytes,
+             uint16_t t0h, uint16_t t1h, uint16_t period) {
     // Reserve channel
     rmt_channel_t channel = ADAFRUIT_RMT_CHANNEL_MAX;
     for (size_t i = 0; i < ADAFRUIT_RMT_CHANNEL_MAX; i++) {
@@ -246,17 +274,10 @@ void espShow(uint8_t pin, uint8_t *pixels, uint32_t numBytes, boolean is800KHz)
     // NS to tick converter
     float ratio = (float)counter_clk_hz / 1e9;
 
-    if (is800KHz) {
-        t0h_ticks = (uint32_t)(ratio * WS2812_T0H_NS);
-        t0l_ticks = (uint32_t)(ratio * WS2812_T0L_NS);
-        t1h_ticks = (uint32_t)(ratio * WS2812_T1H_NS);
-        t1l_ticks = (uint32_t)(ratio * WS2812_T1L_NS);
-    } else {
-        t0h_ticks = (uint32_t)(ratio * WS2811_T0H_NS);
-        t0l_ticks = (uint32_t)(ratio * WS2811_T0L_NS);
-        t1h_ticks = (uint32_t)(ratio * WS2811_T1H_NS);
-        t1l_ticks = (uint32_t)(ratio * WS2811_T1L_NS);
-    }
+    t0h_ticks = (uint32_t)(ratio * t0h);
+    t0l_ticks = (uint32_t)(ratio * (period - t0h));
+    t1h_ticks = (uint32_t)(ratio * t1h);
+    t1l_ticks = (uint32_t)(ratio * (period - t1h));
 
     // Initialize automatic timing translator
     rmt_translator_init(config.channel, ws2812_rmt_adapter);
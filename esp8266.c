@@ -16,20 +16,18 @@ static inline uint32_t _getCycleCount(void) {
   return ccount;
 }
 
+// Bit timing (t0h, t1h, period) is in nanoseconds, see neoPixelTiming.
 #ifdef ESP8266
 IRAM_ATTR void espShow(
- uint8_t pin, uint8_t *pixels, uint32_t numBytes, __attribute__((unused)) boolean is800KHz) {
+ uint8_t pin, uint8_t *pixels, uint32_t numBytes,
+ uint16_t t0h, uint16_t t1h, uint16_t period_ns) {
 #else
 void espShow(
- uint8_t pin, uint8_t *pixels, uint32_t numBytes, boolean is800KHz) {
+ uint8_t pin, uint8_t *pixels, uint32_t numBytes,
+ uint16_t t0h, uint16_t t1h, uint16_t period_ns) {
 #endif
 
-#define CYCLES_800_T0H  (F_CPU / 2500001) // 0.4us
-#define CYCLES_800_T1H  (F_CPU / 1250001) // 0.8us
-#define CYCLES_800      (F_CPU /  800001) // 1.25us per bit
-#define CYCLES_400_T0H  (F_CPU / 2000000) // 0.5uS
-#define CYCLES_400_T1H  (F_CPU /  833333) // 1.2us
-#define CYCLES_400      (F_CPU /  400000) // 2.5us per bit
+#define CYCLES_NS(ns) ((F_CPU / 1000000) * (ns) / 1000)
 
   uint8_t *p, *end, pix, mask;
   uint32_t t, time0, time1, period, c, startTime;
@@ -45,19 +43,9 @@ void espShow(
   mask      = 0x80;
   startTime = 0;
 
-#ifdef NEO_KHZ400
-  if(is800KHz) {
-#endif
-    time0  = CYCLES_800_T0H;
-    time1  = CYCLES_800_T1H;
-    period = CYCLES_800;
-#ifdef NEO_KHZ400
-  } else { // 400 KHz bitstream
-    time0  = CYCLES_400_T0H;
-    time1  = CYCLES_400_T1H;
-    period = CYCLES_400;
-  }
-#endif
+  time0  = CYCLES_NS(t0h);
+  time1  = CYCLES_NS(t1h);
+  period = CYCLES_NS(period_ns);
 
   for(t = time0;; t = time0) {
     if(pix & mask) t = time1;                             // Bit high duration
@@ -0,0 +1,97 @@
+// Runs independent effects on separate zones of one NeoPixel strip, each
+// at its own frame rate, with no delay() calls. The strip is only shown
+// when an effect has actually changed something.
+
+#include <Adafruit_NeoPixel.h>
+#include <Adafruit_NeoPixel_Scheduler.h>
+#include <Adafruit_NeoPixel_Segment.h>
+
+// Which pin on the Arduino is connected to the NeoPixels?
+#ifdef ESP32
+// Cannot use 6 as output for ESP. Pins 6-11 are connected to SPI flash. Use 16 instead.
+#define LED_PIN    16
+#else
+#define LED_PIN    6
+#endif
+
+// How many NeoPixels are attached to the Arduino?
+#define LED_COUNT 60
+
+Adafruit_NeoPixel strip(LED_COUNT, LED_PIN, NEO_GRB + NEO_KHZ800);
+
+// Split the strip into two zones; the second runs backward
+Adafruit_NeoPixel_Chain chain(strip);
+Adafruit_NeoPixel_Segment zone1(chain, 0, LED_COUNT / 2);
+Adafruit_NeoPixel_Segment zone2(chain, LED_COUNT / 2, LED_COUNT / 2, true);
+
+// Rainbow cycling along a zone, changing every frame
+class Rainbow : public Adafruit_NeoPixel_Effect {
+public:
+  Rainbow(Adafruit_NeoPixel_Segment &zone) : zone(zone) {}
+  bool update(uint32_t now) {
+    uint16_t first = now * 20; // Hue shifts 20 units per millisecond
+    for (uint16_t i = 0; i < zone.numPixels(); i++) {
+      uint16_t hue = first + i * 65536L / zone.numPixels();
+      zone.setPixelColor(i, strip.gamma32(strip.ColorHSV(hue)));
+    }
+    return true;
+  }
+
+private:
+  Adafruit_NeoPixel_Segment &zone;
+};
+
+// A dot bouncing back and forth along a zone
+class Bounce : public Adafruit_NeoPixel_Effect {
+public:
+  Bounce(Adafruit_NeoPixel_Segment &zone) : zone(zone), pos(0), dir(1) {}
+  bool update(uint32_t) {
+    zone.setPixelColor(pos, 0);
+    if ((pos + dir < 0) || (pos + dir >= zone.numPixels()))
+      dir = -dir;
+    pos += dir;
+    zone.setPixelColor(pos, strip.Color(255, 255, 255));
+    return true;
+  }
+
+private:
+  Adafruit_NeoPixel_Segment &zone;
+  int16_t pos;
+  int8_t dir;
+};
+
+Rainbow rainbow(zone1);
+Bounce bounce(zone2);
+Adafruit_NeoPixel_Scheduler scheduler;
+
+void setup() {
+  Serial.begin(115200);
+  strip.begin();           // INITIALIZE NeoPixel strip object (REQUIRED)
+  strip.show();            // Turn OFF all pixels ASAP
+  strip.setBrightness(50); // Set BRIGHTNESS to about 1/5 (max = 255)
+
+  scheduler.add(rainbow, chain, 60); // 60 frames per second
+  scheduler.add(bounce, chain, 15);  // 15 frames per second
+}
+
+void loop() {
+  scheduler.run(); // Call often; other non-blocking work can go here too
+
+  // Report each effect's render time every few seconds
+  static uint32_t lastReport = 0;
+  if ((millis() - lastReport) >= 5000) {
+    lastReport = millis();
+    for (uint8_t i = 0; i < scheduler.numEffects(); i++) {
+      const neoEffectStats &s = scheduler.getStats(i);
+      Serial.print("Effect ");
+      Serial.print(i);
+      Serial.print(": ");
+      Serial.print(s.render);
+      Serial.print(" us avg, ");
+      Serial.print(s.renderMax);
+      Serial.print(" us max, ");
+      Serial.print(s.late);
+      Serial.println(" frames late");
+    }
+  }
+}
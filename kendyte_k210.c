@@ -10,16 +10,13 @@
 #include <Arduino.h>
 #include "sysctl.h"
 
+// Bit timing (t0h, t1h, period) is in nanoseconds, see neoPixelTiming.
 void  k210Show(
-    uint8_t pin, uint8_t *pixels, uint32_t numBytes, boolean is800KHz)
+    uint8_t pin, uint8_t *pixels, uint32_t numBytes,
+    uint16_t t0h, uint16_t t1h, uint16_t period_ns)
 {
 
-#define CYCLES_800_T0H (sysctl_clock_get_freq(SYSCTL_CLOCK_CPU) / 2500000) // 0.4us
-#define CYCLES_800_T1H (sysctl_clock_get_freq(SYSCTL_CLOCK_CPU) / 1250000) // 0.8us
-#define CYCLES_800 (sysctl_clock_get_freq(SYSCTL_CLOCK_CPU) / 800000)      // 1.25us per bit
-#define CYCLES_400_T0H (sysctl_clock_get_freq(SYSCTL_CLOCK_CPU) / 2000000) // 0.5uS
-#define CYCLES_400_T1H (sysctl_clock_get_freq(SYSCTL_CLOCK_CPU) / 833333)  // 1.2us
-#define CYCLES_400 (sysctl_clock_get_freq(SYSCTL_CLOCK_CPU) / 400000)      // 2.5us per bit
+#define CYCLES_NS(ns) ((sysctl_clock_get_freq(SYSCTL_CLOCK_CPU) / 1000000) * (ns) / 1000)
 
     uint8_t *p, *end, pix, mask;
     uint32_t t, time0, time1, period, c, startTime;
@@ -30,22 +27,9 @@ void  k210Show(
     mask = 0x80;
     startTime = 0;
 
-#ifdef NEO_KHZ400
-    if (is800KHz)
-    {
-#endif
-        time0 = CYCLES_800_T0H;
-        time1 = CYCLES_800_T1H;
-        period = CYCLES_800;
-#ifdef NEO_KHZ400
-    }
-    else
-    { // 400 KHz bitstream
-        time0 = CYCLES_400_T0H;
-        time1 = CYCLES_400_T1H;
-        period = CYCLES_400;
-    }
-#endif
+    time0 = CYCLES_NS(t0h);
+    time1 = CYCLES_NS(t1h);
+    period = CYCLES_NS(period_ns);
 
     for (t = time0;; t = time0)
     {